@@ -116,6 +116,12 @@ else()
     list(APPEND MUSTARD_PUBLIC_COMPILE_DEFINITIONS MUSTARD_SIGNAL_HANDLER=0)
 endif()
 
+if(MUSTARD_TRACING)
+    list(APPEND MUSTARD_PUBLIC_COMPILE_DEFINITIONS MUSTARD_TRACING=1)
+else()
+    list(APPEND MUSTARD_PUBLIC_COMPILE_DEFINITIONS MUSTARD_TRACING=0)
+endif()
+
 if(MUSTARD_USE_G4VIS)
     list(APPEND MUSTARD_PUBLIC_COMPILE_DEFINITIONS MUSTARD_USE_G4VIS=1)
 else()
@@ -22,6 +22,7 @@
 #include "Mustard/Data/TupleModel.h++"
 #include "Mustard/Data/internal/BranchHelper.h++"
 #include "Mustard/Env/Print.h++"
+#include "Mustard/Env/Trace.h++"
 #include "Mustard/Utility/NonMoveableBase.h++"
 
 #include "TDirectory.h"
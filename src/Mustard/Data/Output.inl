@@ -57,6 +57,7 @@ template<TupleModelizable... Ts>
 template<typename T>
     requires std::assignable_from<Tuple<Ts...>&, T&&> or ProperSubTuple<Tuple<Ts...>, std::decay_t<T>>
 auto Output<Ts...>::Fill(T&& tuple) -> std::size_t {
+    MUSTARD_TRACE_SCOPE("Data::Output::Fill");
     const auto nByte{FillImpl<T>(std::forward<T>(tuple))};
     TimedAutoSaveIfNecessary();
     return nByte;
@@ -67,6 +68,7 @@ template<std::ranges::input_range R>
     requires std::assignable_from<Tuple<Ts...>&, std::ranges::range_reference_t<R>> or
                  ProperSubTuple<Tuple<Ts...>, std::ranges::range_value_t<R>>
 auto Output<Ts...>::Fill(R&& data) -> std::size_t {
+    MUSTARD_TRACE_SCOPE("Data::Output::Fill");
     std::size_t nByte{};
     for (auto&& tuple : std::forward<R>(data)) {
         nByte += FillImpl(muc::forward_like<R>(tuple));
@@ -81,6 +83,7 @@ template<std::ranges::input_range R>
                  (std::assignable_from<Tuple<Ts...>&, std::iter_reference_t<std::ranges::range_value_t<R>>> or
                   ProperSubTuple<Tuple<Ts...>, std::iter_value_t<std::ranges::range_value_t<R>>>)
 auto Output<Ts...>::Fill(R&& data) -> std::size_t {
+    MUSTARD_TRACE_SCOPE("Data::Output::Fill");
     std::size_t nByte{};
     for (auto&& i : std::forward<R>(data)) {
         nByte += FillImpl(std::forward<decltype(*i)>(*i));
@@ -119,6 +122,7 @@ auto Output<Ts...>::TimedAutoSaveIfNecessary() -> std::size_t {
     if (not fTimedAutoSaveEnabled) { return 0; }
     if (Second{fTimedAutoSaveStopwatch.s_elapsed()} < fTimedAutoSavePeriod) { return 0; }
     fTimedAutoSaveStopwatch = {};
+    MUSTARD_TRACE_SCOPE("Data::Output::AutoSave");
     return fTree->AutoSave("SaveSelf");
 }
 
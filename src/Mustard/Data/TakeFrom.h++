@@ -20,6 +20,7 @@
 
 #include "Mustard/Data/Tuple.h++"
 #include "Mustard/Data/internal/TypeTraits.h++"
+#include "Mustard/Env/Trace.h++"
 #include "Mustard/Extension/ROOTX/RDataFrame.h++"
 #include "Mustard/Extension/gslx/index_sequence.h++"
 #include "Mustard/Utility/NonConstructibleBase.h++"
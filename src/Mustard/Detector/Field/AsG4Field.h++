@@ -21,6 +21,7 @@
 #include "Mustard/Detector/Field/ElectricField.h++"
 #include "Mustard/Detector/Field/ElectromagneticField.h++"
 #include "Mustard/Detector/Field/MagneticField.h++"
+#include "Mustard/Detector/Field/TimeDependentField.h++"
 #include "Mustard/Utility/NonMoveableBase.h++"
 #include "Mustard/Utility/VectorCast.h++"
 
@@ -32,6 +33,7 @@
 
 #include <algorithm>
 #include <bit>
+#include <concepts>
 #include <type_traits>
 #include <utility>
 
@@ -45,15 +47,20 @@ public:
     auto DoesFieldChangeEnergy() const -> G4bool override final { return AChangeEnergy; }
 };
 
+/// @brief The Geant4 field class for AField. Note that in Geant4 G4ElectricField and
+/// G4ElectroMagneticField derive from G4MagneticField, so dispatch on the exact type.
+template<ElectromagneticField AField, bool AEMFieldChangeEnergy>
+using G4FieldBase = std::conditional_t<MagneticField<AField>,
+                                       G4MagneticField,
+                                       std::conditional_t<ElectricField<AField>,
+                                                          G4ElectricField,
+                                                          G4EMFieldBase<AEMFieldChangeEnergy>>>;
+
 } // namespace internal
 
 template<ElectromagneticField AField, bool AEMFieldChangeEnergy = true>
 class AsG4Field : public NonMoveableBase,
-                  public std::conditional_t<MagneticField<AField>,
-                                            G4MagneticField,
-                                            std::conditional_t<ElectricField<AField>,
-                                                               G4ElectricField,
-                                                               internal::G4EMFieldBase<AEMFieldChangeEnergy>>>,
+                  public internal::G4FieldBase<AField, AEMFieldChangeEnergy>,
                   public AField {
 public:
     using AField::AField;
@@ -20,10 +20,28 @@ namespace Mustard::Detector::Field {
 
 template<ElectromagneticField AField, bool AEMFieldChangeEnergy>
 auto AsG4Field<AField, AEMFieldChangeEnergy>::GetFieldValue(const G4double* x, G4double* f) const -> void {
-    std::ranges::copy(std::bit_cast<std::array<G4double, 6>>(
-                          this->BE(
-                              VectorCast<muc::array3d>(x))),
-                      f);
+    // x = (x, y, z, t), time is passed to time-dependent fields
+    const auto& field{static_cast<const AField&>(*this)};
+    if constexpr (requires(muc::array3d point) { { field.Contains(point) } -> std::same_as<bool>; }) {
+        // the field is zero outside its region (e.g. a BoundedField), skip everything else
+        if (not field.Contains(VectorCast<muc::array3d>(x))) {
+            std::ranges::fill_n(f, std::same_as<internal::G4FieldBase<AField, AEMFieldChangeEnergy>, G4MagneticField> ? 3 : 6, 0.);
+            return;
+        }
+    }
+    if constexpr (std::same_as<internal::G4FieldBase<AField, AEMFieldChangeEnergy>, G4MagneticField>) {
+        // G4MagneticField: Geant4 reads B only
+        std::ranges::copy(internal::BAt(field, VectorCast<muc::array3d>(x), x[3]), f);
+    } else if constexpr (std::same_as<internal::G4FieldBase<AField, AEMFieldChangeEnergy>, G4ElectricField>) {
+        // G4ElectricField: Geant4 reads B and E, B is known to be zero
+        std::ranges::fill_n(f, 3, 0.);
+        std::ranges::copy(internal::EAt(field, VectorCast<muc::array3d>(x), x[3]), f + 3);
+    } else {
+        std::ranges::copy(std::bit_cast<std::array<G4double, 6>>(
+                              internal::BEAt(field,
+                                             VectorCast<muc::array3d>(x), x[3])),
+                          f);
+    }
 }
 
 } // namespace Mustard::Detector::Field
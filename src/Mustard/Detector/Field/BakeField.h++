@@ -0,0 +1,90 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Detector/Field/ElectricField.h++"
+#include "Mustard/Detector/Field/ElectricFieldMap.h++"
+#include "Mustard/Detector/Field/ElectromagneticField.h++"
+#include "Mustard/Detector/Field/ElectromagneticFieldMap.h++"
+#include "Mustard/Detector/Field/GridFieldMap3D.h++"
+#include "Mustard/Detector/Field/MagneticField.h++"
+#include "Mustard/Detector/Field/MagneticFieldMap.h++"
+#include "Mustard/Detector/Field/TimeDependentField.h++"
+#include "Mustard/Env/Logging.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Utility/PrettyLog.h++"
+#include "Mustard/Utility/VectorCast.h++"
+
+#include "EFM/FieldMap3D.h++"
+
+#include "Eigen/Core"
+
+#include "fmt/format.h"
+
+#include "mpi.h"
+
+#include "muc/array"
+#include "muc/functional"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <exception>
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Mustard::Detector::Field {
+
+/// @brief Field map type returned by `BakeField`: a `GridFieldMap3D` holding the field in CLHEP
+/// units, wrapped as a magnetic, electric or electromagnetic ("NoCache") field like `AField`.
+template<ElectromagneticField AField, typename AStorage = double>
+using BakedField = std::conditional_t<
+    MagneticField<AField>,
+    MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d, muc::multidentity, EFM::Identity, AStorage>>,
+    std::conditional_t<
+        ElectricField<AField>,
+        ElectricFieldMap<GridFieldMap3D<Eigen::Vector3d, muc::multidentity, EFM::Identity, AStorage>>,
+        ElectromagneticFieldMap<"NoCache", GridFieldMap3D<Eigen::Vector<double, 6>, muc::multidentity, EFM::Identity, AStorage>>>>;
+
+/// @brief Resamples a field (e.g. a `FieldSuperposition` of many placed fields) on a regular grid
+/// over [x0, x1] with n nodes per axis. The resulting map costs one interpolation per query
+/// regardless of how expensive the field is, at the price of the interpolation error of the grid.
+/// A time-dependent field is sampled at time t.
+template<typename AStorage = double, ElectromagneticField AField>
+auto BakeField(const AField& field, muc::array3d x0, muc::array3d x1, std::array<int, 3> n, double t = 0) -> BakedField<AField, AStorage>;
+
+/// @brief Same as above, but keeps the grid in a binary field map file (see `GridFieldMapFile`).
+/// The file is mapped instead of resampling if it exists, has the same grid, and agrees with the
+/// field at about 1/64 of the nodes (within 2^-7 of the largest probed component), which costs
+/// about 1/64 of baking. Otherwise the field is baked again and the file is (re)written.
+/// The check is a heuristic: a change of the field confined between probe nodes goes unnoticed,
+/// so remove the file when in doubt.
+/// Under MPI this is collective on MPI_COMM_WORLD: world master checks and (re)writes the file,
+/// then all processes map it. A process that cannot map it (e.g. the file system is not shared
+/// with world master) bakes the field itself.
+template<typename AStorage = double, ElectromagneticField AField>
+auto BakeField(const AField& field, muc::array3d x0, muc::array3d x1, std::array<int, 3> n, const std::filesystem::path& cache, double t = 0) -> BakedField<AField, AStorage>;
+
+} // namespace Mustard::Detector::Field
+
+#include "Mustard/Detector/Field/BakeField.inl"
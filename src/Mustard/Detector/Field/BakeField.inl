@@ -0,0 +1,125 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Detector::Field {
+
+namespace internal {
+
+template<typename AMap, ElectromagneticField AField>
+auto BakedNodeValue(const AField& field, double x, double y, double z, double t) -> typename AMap::ValueType {
+    const muc::array3d p{x, y, z};
+    if constexpr (MagneticField<AField>) {
+        return VectorCast<Eigen::Vector3d>(BAt(field, p, t));
+    } else if constexpr (ElectricField<AField>) {
+        return VectorCast<Eigen::Vector3d>(EAt(field, p, t));
+    } else {
+        const auto [b, e]{BEAt(field, p, t)};
+        return {b[0], b[1], b[2], e[0], e[1], e[2]};
+    }
+}
+
+} // namespace internal
+
+template<typename AStorage, ElectromagneticField AField>
+auto BakeField(const AField& field, muc::array3d x0, muc::array3d x1, std::array<int, 3> n, double t) -> BakedField<AField, AStorage> {
+    using Map = BakedField<AField, AStorage>;
+    return Map{x0, x1, n, [&](double x, double y, double z) { return internal::BakedNodeValue<Map>(field, x, y, z, t); }};
+}
+
+template<typename AStorage, ElectromagneticField AField>
+auto BakeField(const AField& field, muc::array3d x0, muc::array3d x1, std::array<int, 3> n, const std::filesystem::path& cache, double t) -> BakedField<AField, AStorage> {
+    using Map = BakedField<AField, AStorage>;
+    constexpr auto coordinateUnit{"mm"};
+    constexpr auto fieldUnit{"CLHEP"};
+
+    const auto Fresh{[&](const Map& map) {
+        if (map.X0() != x0 or map.X1() != x1 or map.N() != n) { return false; }
+        // about 1/64 of the nodes along a low-discrepancy (R3) sequence, and the corners
+        const auto nNode{static_cast<long long>(n[0]) * n[1] * n[2]};
+        const auto nProbe{8 + nNode / 64};
+        constexpr std::array<double, 3> step{0.8191725133961645, 0.6710436067037893, 0.5497004779019703};
+        std::vector<std::pair<typename Map::ValueType, typename Map::ValueType>> probe; // (expected, found)
+        probe.reserve(nProbe);
+        auto maxAbs{0.};
+        for (long long p{}; p < nProbe; ++p) {
+            std::array<double, 3> node;
+            for (int i{}; i < 3; ++i) {
+                const auto q{p < 8 ? static_cast<double>((p >> i) & 1) : std::fmod(0.5 + step[i] * p, 1.)};
+                node[i] = x0[i] + (x1[i] - x0[i]) * std::round(q * (n[i] - 1)) / (n[i] - 1);
+            }
+            const auto& [expected, found]{probe.emplace_back(internal::BakedNodeValue<Map>(field, node[0], node[1], node[2], t),
+                                                             map(node[0], node[1], node[2]))};
+            maxAbs = std::max(maxAbs, expected.cwiseAbs().maxCoeff());
+        }
+        const auto tolerance{0x1p-7 * maxAbs};
+        return std::ranges::all_of(probe, [&](auto&& ef) { return (ef.second - ef.first).cwiseAbs().maxCoeff() <= tolerance; });
+    }};
+
+    const auto Load{[&]() -> std::optional<Map> {
+        if (not std::filesystem::exists(cache)) { return std::nullopt; }
+        try {
+            Map map{cache, coordinateUnit, fieldUnit};
+            if (Fresh(map)) { return map; }
+            Env::PrintPrettyWarning(fmt::format("Baked field '{}' is stale, baking again", cache.generic_string()));
+        } catch (const std::runtime_error& e) {
+            Env::PrintPrettyWarning(fmt::format("Baked field '{}' unusable ({}), baking again", cache.generic_string(), e.what()));
+        }
+        return std::nullopt;
+    }};
+    const auto Bake{[&] {
+        auto map{BakeField<AStorage>(field, x0, x1, n, t)};
+        map.Save(cache, coordinateUnit, fieldUnit);
+        return map;
+    }};
+
+    if (not Env::MPIEnv::Available() or Env::MPIEnv::Instance().Sequential()) {
+        if (auto map{Load()}) { return std::move(*map); }
+        return Bake();
+    }
+
+    // world master checks and (re)writes the file, then all processes map it
+    auto written{true};
+    if (Env::MPIEnv::Instance().OnCommWorldMaster()) {
+        try {
+            if (not Load()) { Bake(); }
+        } catch (const std::exception& e) {
+            Env::PrintPrettyWarning(fmt::format("Failed to bake field into '{}' ({}), baking in each process", cache.generic_string(), e.what()));
+            written = false;
+        }
+    }
+    MPI_Bcast(&written,        // buffer
+              1,               // count
+              MPI_CXX_BOOL,    // datatype
+              0,               // root
+              MPI_COMM_WORLD); // comm
+    std::optional<Map> map;
+    if (written) {
+        try {
+            map.emplace(cache, coordinateUnit, fieldUnit);
+        } catch (const std::runtime_error& e) {
+            // e.g. the file system is not shared with world master
+            Env::PrintPrettyWarning(fmt::format("Baked field '{}' unusable ({}), baking in this process", cache.generic_string(), e.what()));
+        }
+    }
+    // nobody rewrites the file (e.g. in a later call) before all processes have mapped it
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (map) { return std::move(*map); }
+    return BakeField<AStorage>(field, x0, x1, n, t);
+}
+
+} // namespace Mustard::Detector::Field
@@ -0,0 +1,131 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Concept/NumericVector.h++"
+#include "Mustard/Detector/Field/ElectricField.h++"
+#include "Mustard/Detector/Field/ElectromagneticField.h++"
+#include "Mustard/Detector/Field/ElectromagneticFieldBase.h++"
+#include "Mustard/Detector/Field/MagneticField.h++"
+#include "Mustard/Detector/Field/TimeDependentField.h++"
+#include "Mustard/Utility/PrettyLog.h++"
+#include "Mustard/Utility/VectorCast.h++"
+
+#include "Eigen/Core"
+#include "Eigen/Geometry"
+
+#include "muc/array"
+#include "muc/ceta_string"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace Mustard::Detector::Field {
+
+/// @brief A field restricted to a box [x0, x1], axis-aligned in the coordinates of the field or
+/// oriented by a rigid transformation. Inside the box the underlying field is evaluated as is.
+/// Outside, the behavior is set by AOutside:
+///  - "Zero": the field is zero and the underlying field is not evaluated, which costs a few
+///    comparisons (plus a transformation for an oriented box). Only this variant has `Contains`,
+///    which means that the field is zero outside: `FieldSuperposition` skips the field there and
+///    `AsG4Field` returns zero right away.
+///  - "Clamp": the value at the nearest point of the box.
+///  - "Extrapolate": linear extrapolation from the nearest point of the box, the derivative along
+///    each box axis being a one-sided difference over 1/64 of the box size. It costs one more
+///    evaluation per axis outside, and is meant for short distances.
+/// E.g. a map valid on its grid only, and zero elsewhere:
+///     BoundedField<MagneticFieldMap<...>> field{x0, x1, mapArgs...};
+/// Place it with `PlacedField` to move the field together with its box.
+template<ElectromagneticField AField, muc::ceta_string AOutside = "Zero">
+    requires(AOutside == "Zero" or AOutside == "Clamp" or AOutside == "Extrapolate")
+class BoundedField : public ElectromagneticFieldBase<BoundedField<AField, AOutside>> {
+private:
+    template<Concept::NumericVector3D T>
+    using F = typename ElectromagneticFieldBase<BoundedField<AField, AOutside>>::template F<T>;
+
+public:
+    /// @brief Axis-aligned box, constructs the underlying field from args.
+    /// @exception Throw a std::invalid_argument if x1 > x0 does not hold on every axis.
+    template<typename... Args>
+        requires std::constructible_from<AField, Args&&...>
+    BoundedField(muc::array3d x0, muc::array3d x1, Args&&... args);
+    /// @brief Oriented box, constructs the underlying field from args.
+    /// @param box box-to-field transformation, [x0, x1] is in box coordinates
+    /// @exception Throw a std::invalid_argument if x1 > x0 does not hold on every axis.
+    template<typename... Args>
+        requires std::constructible_from<AField, Args&&...>
+    BoundedField(const Eigen::Transform<double, 3, Eigen::Isometry>& box, muc::array3d x0, muc::array3d x1, Args&&... args);
+
+    auto Field() const -> const AField& { return fField; }
+    auto X0() const -> const auto& { return fX0; }
+    auto X1() const -> const auto& { return fX1; }
+
+    template<Concept::NumericVector3D T>
+        requires(AOutside == "Zero")
+    auto Contains(T x) const -> bool { return Inside(ToBox(x)); }
+
+    template<Concept::NumericVector3D T>
+        requires ElectricField<AField>
+    static constexpr auto B(T, double = 0) -> T { return {0, 0, 0}; }
+    template<Concept::NumericVector3D T>
+        requires(not ElectricField<AField>)
+    auto B(T x, double t = 0) const -> T;
+    template<Concept::NumericVector3D T>
+        requires MagneticField<AField>
+    static constexpr auto E(T, double = 0) -> T { return {0, 0, 0}; }
+    template<Concept::NumericVector3D T>
+        requires(not MagneticField<AField>)
+    auto E(T x, double t = 0) const -> T;
+    template<Concept::NumericVector3D T>
+    auto BE(T x, double t = 0) const -> F<T>;
+
+private:
+    template<Concept::NumericVector3D T>
+    auto ToBox(T x) const -> muc::array3d;
+    auto FromBox(muc::array3d xb) const -> muc::array3d;
+    auto CheckBox() const -> void;
+    auto Inside(const muc::array3d& xb) const -> bool;
+    /// @brief Applies the outside policy to f: muc::array3d -> std::array<double, N>.
+    template<std::size_t N, Concept::NumericVector3D T, typename AEvaluate>
+    auto Evaluate(T x, AEvaluate&& f) const -> std::array<double, N>;
+
+private:
+    muc::array3d fX0;
+    muc::array3d fX1;
+    bool fOriented;
+    Eigen::Transform<double, 3, Eigen::Isometry> fToBox;
+    Eigen::Matrix3d fFromBoxRotation;
+    muc::array3d fFromBoxTranslation;
+    AField fField;
+};
+
+template<typename AField>
+BoundedField(muc::array3d, muc::array3d, AField) -> BoundedField<AField>;
+
+template<typename AField>
+BoundedField(const Eigen::Transform<double, 3, Eigen::Isometry>&, muc::array3d, muc::array3d, AField) -> BoundedField<AField>;
+
+} // namespace Mustard::Detector::Field
+
+#include "Mustard/Detector/Field/BoundedField.inl"
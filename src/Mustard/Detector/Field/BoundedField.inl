@@ -0,0 +1,144 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Detector::Field {
+
+template<ElectromagneticField AField, muc::ceta_string AOutside>
+    requires(AOutside == "Zero" or AOutside == "Clamp" or AOutside == "Extrapolate")
+template<typename... Args>
+    requires std::constructible_from<AField, Args&&...>
+BoundedField<AField, AOutside>::BoundedField(muc::array3d x0, muc::array3d x1, Args&&... args) :
+    ElectromagneticFieldBase<BoundedField<AField, AOutside>>{},
+    fX0{x0},
+    fX1{x1},
+    fOriented{false},
+    fToBox{Eigen::Transform<double, 3, Eigen::Isometry>::Identity()},
+    fFromBoxRotation{Eigen::Matrix3d::Identity()},
+    fFromBoxTranslation{},
+    fField(std::forward<Args>(args)...) {
+    CheckBox();
+}
+
+template<ElectromagneticField AField, muc::ceta_string AOutside>
+    requires(AOutside == "Zero" or AOutside == "Clamp" or AOutside == "Extrapolate")
+template<typename... Args>
+    requires std::constructible_from<AField, Args&&...>
+BoundedField<AField, AOutside>::BoundedField(const Eigen::Transform<double, 3, Eigen::Isometry>& box, muc::array3d x0, muc::array3d x1, Args&&... args) :
+    ElectromagneticFieldBase<BoundedField<AField, AOutside>>{},
+    fX0{x0},
+    fX1{x1},
+    fOriented{true},
+    fToBox{box.inverse()},
+    fFromBoxRotation{box.linear()},
+    fFromBoxTranslation{VectorCast<muc::array3d>(Eigen::Vector3d{box.translation()})},
+    fField(std::forward<Args>(args)...) {
+    CheckBox();
+}
+
+template<ElectromagneticField AField, muc::ceta_string AOutside>
+    requires(AOutside == "Zero" or AOutside == "Clamp" or AOutside == "Extrapolate")
+template<Concept::NumericVector3D T>
+    requires(not ElectricField<AField>)
+auto BoundedField<AField, AOutside>::B(T x, double t) const -> T {
+    return VectorCast<T>(Evaluate<3>(x, [&](const muc::array3d& p) { return internal::BAt(fField, p, t); }));
+}
+
+template<ElectromagneticField AField, muc::ceta_string AOutside>
+    requires(AOutside == "Zero" or AOutside == "Clamp" or AOutside == "Extrapolate")
+template<Concept::NumericVector3D T>
+    requires(not MagneticField<AField>)
+auto BoundedField<AField, AOutside>::E(T x, double t) const -> T {
+    return VectorCast<T>(Evaluate<3>(x, [&](const muc::array3d& p) { return internal::EAt(fField, p, t); }));
+}
+
+template<ElectromagneticField AField, muc::ceta_string AOutside>
+    requires(AOutside == "Zero" or AOutside == "Clamp" or AOutside == "Extrapolate")
+template<Concept::NumericVector3D T>
+auto BoundedField<AField, AOutside>::BE(T x, double t) const -> F<T> {
+    const auto f{Evaluate<6>(x, [&](const muc::array3d& p) {
+        const auto [b, e]{internal::BEAt(fField, p, t)};
+        return std::array<double, 6>{b[0], b[1], b[2], e[0], e[1], e[2]};
+    })};
+    return {{f[0], f[1], f[2]}, {f[3], f[4], f[5]}};
+}
+
+template<ElectromagneticField AField, muc::ceta_string AOutside>
+    requires(AOutside == "Zero" or AOutside == "Clamp" or AOutside == "Extrapolate")
+template<Concept::NumericVector3D T>
+auto BoundedField<AField, AOutside>::ToBox(T x) const -> muc::array3d {
+    if (not fOriented) { return {x[0], x[1], x[2]}; }
+    return VectorCast<muc::array3d>(Eigen::Vector3d{fToBox * VectorCast<Eigen::Vector3d>(x)});
+}
+
+template<ElectromagneticField AField, muc::ceta_string AOutside>
+    requires(AOutside == "Zero" or AOutside == "Clamp" or AOutside == "Extrapolate")
+auto BoundedField<AField, AOutside>::FromBox(muc::array3d xb) const -> muc::array3d {
+    if (not fOriented) { return xb; }
+    const Eigen::Vector3d x{fFromBoxRotation * VectorCast<Eigen::Vector3d>(xb) + VectorCast<Eigen::Vector3d>(fFromBoxTranslation)};
+    return VectorCast<muc::array3d>(x);
+}
+
+template<ElectromagneticField AField, muc::ceta_string AOutside>
+    requires(AOutside == "Zero" or AOutside == "Clamp" or AOutside == "Extrapolate")
+auto BoundedField<AField, AOutside>::CheckBox() const -> void {
+    // a flat box contains almost nothing, and has no inward difference for extrapolation
+    if (not(fX0[0] < fX1[0] and fX0[1] < fX1[1] and fX0[2] < fX1[2])) {
+        throw std::invalid_argument{PrettyException("Bounded field requires x1 > x0 on every axis")};
+    }
+}
+
+template<ElectromagneticField AField, muc::ceta_string AOutside>
+    requires(AOutside == "Zero" or AOutside == "Clamp" or AOutside == "Extrapolate")
+auto BoundedField<AField, AOutside>::Inside(const muc::array3d& xb) const -> bool {
+    return fX0[0] <= xb[0] and xb[0] <= fX1[0] and
+           fX0[1] <= xb[1] and xb[1] <= fX1[1] and
+           fX0[2] <= xb[2] and xb[2] <= fX1[2];
+}
+
+template<ElectromagneticField AField, muc::ceta_string AOutside>
+    requires(AOutside == "Zero" or AOutside == "Clamp" or AOutside == "Extrapolate")
+template<std::size_t N, Concept::NumericVector3D T, typename AEvaluate>
+auto BoundedField<AField, AOutside>::Evaluate(T x, AEvaluate&& f) const -> std::array<double, N> {
+    const auto xb{ToBox(x)};
+    if (Inside(xb)) [[likely]] {
+        return f(muc::array3d{x[0], x[1], x[2]});
+    }
+    if constexpr (AOutside == "Zero") {
+        return {};
+    } else {
+        muc::array3d xc;
+        for (int i{}; i < 3; ++i) { xc[i] = std::clamp(xb[i], fX0[i], fX1[i]); }
+        auto value{f(FromBox(xc))};
+        if constexpr (AOutside == "Extrapolate") {
+            const auto fc{value};
+            for (int i{}; i < 3; ++i) {
+                const auto d{xb[i] - xc[i]};
+                if (d == 0) { continue; }
+                // one-sided difference towards the inside of the box
+                const auto h{(fX1[i] - fX0[i]) / 64};
+                auto xi{xc};
+                xi[i] += d > 0 ? -h : h;
+                const auto fi{f(FromBox(xi))};
+                for (std::size_t c{}; c < N; ++c) { value[c] += (fc[c] - fi[c]) / h * std::abs(d); }
+            }
+        }
+        return value;
+    }
+}
+
+} // namespace Mustard::Detector::Field
@@ -23,7 +23,9 @@
 #include "Mustard/Detector/Field/ElectromagneticFieldBase.h++"
 #include "Mustard/Detector/Field/MagneticFieldBase.h++"
 
+#include <algorithm>
 #include <concepts>
+#include <span>
 
 namespace Mustard::Detector::Field {
 
@@ -45,6 +47,11 @@ public:
     static constexpr auto B(T) -> T { return {0, 0, 0}; }
     template<Concept::NumericVector3D T>
     constexpr auto BE(T x) const -> F<T> { return {B(x), static_cast<const ADerived*>(this)->E(x)}; }
+
+    template<Concept::NumericVector3D T>
+    static auto BatchB(std::span<const T>, std::span<T> b) -> void { std::ranges::fill(b, T{0, 0, 0}); }
+    template<Concept::NumericVector3D T>
+    auto BatchBE(std::span<const T> x, std::span<T> b, std::span<T> e) const -> void;
 };
 
 } // namespace Mustard::Detector::Field
@@ -26,4 +26,11 @@ constexpr ElectricFieldBase<ADerived>::ElectricFieldBase() :
     static_assert(ElectricField<ADerived>);
 }
 
+template<typename ADerived>
+template<Concept::NumericVector3D T>
+auto ElectricFieldBase<ADerived>::BatchBE(std::span<const T> x, std::span<T> b, std::span<T> e) const -> void {
+    BatchB(x, b);
+    static_cast<const ADerived*>(this)->BatchE(x, e);
+}
+
 } // namespace Mustard::Detector::Field
@@ -22,6 +22,9 @@
 #include "Mustard/Concept/NumericVector.h++"
 #include "Mustard/Detector/Field/ElectricFieldBase.h++"
 #include "Mustard/Detector/Field/FieldMapSymmetry.h++"
+#include "Mustard/Detector/Field/GridFieldMapRZ.h++"
+#include "Mustard/Detector/Field/internal/BatchInterpolate.h++"
+#include "Mustard/Env/Trace.h++"
 #include "Mustard/Utility/InlineMacro.h++"
 #include "Mustard/Utility/VectorCast.h++"
 
@@ -33,6 +36,10 @@
 
 #include "muc/functional"
 
+#include <cassert>
+#include <cstddef>
+#include <span>
+
 namespace Mustard::Detector::Field {
 
 /// @brief A functional type converts E-field SI field value
@@ -58,7 +65,17 @@ public:
     using AFieldMap::AFieldMap;
 
     template<Concept::NumericVector3D T>
-    auto E(T x) const -> T { return VectorCast<T>((*this)(x[0], x[1], x[2])); }
+    auto E(T x) const -> T {
+        MUSTARD_TRACE_SCOPE("Detector::Field::ElectricFieldMap");
+        return VectorCast<T>((*this)(x[0], x[1], x[2]));
+    }
+
+    template<Concept::NumericVector3D T>
+    auto BatchE(std::span<const T> x, std::span<T> e) const -> void {
+        assert(e.size() == x.size());
+        MUSTARD_TRACE_SCOPE("Detector::Field::ElectricFieldMap::Batch");
+        internal::BatchInterpolate<AFieldMap>(*this, x, [&](std::size_t i, auto&& f) { e[i] = VectorCast<T>(f); });
+    }
 };
 
 /// @brief An YZ plane mirror symmetry electric field interpolated from data.
@@ -96,4 +113,8 @@ template<Concept::MathVector3D T = Eigen::Vector3d>
 using ElectricFieldMapSymmetryXYZ = ElectricFieldMap<
     EFM::FieldMap3D<T, double, CoordinateSymmetryXYZ, EFieldSI2CLHEP<FieldSymmetryXYZ>>>;
 
+/// @brief An axisymmetric electric field interpolated from (r, z) data, see `GridFieldMapRZ`.
+template<Concept::MathVector3D T = Eigen::Vector3d>
+using ElectricFieldMapRZ = ElectricFieldMap<GridFieldMapRZ<T, EFieldSI2CLHEP<>>>;
+
 } // namespace Mustard::Detector::Field
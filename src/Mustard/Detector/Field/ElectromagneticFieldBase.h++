@@ -23,7 +23,11 @@
 
 #include "muc/array"
 
+#include <cassert>
 #include <concepts>
+#include <cstddef>
+#include <span>
+#include <utility>
 
 namespace Mustard::Detector::Field {
 
@@ -46,6 +50,17 @@ public:
 protected:
     constexpr ElectromagneticFieldBase();
     constexpr ~ElectromagneticFieldBase() = default;
+
+public:
+    /// @brief Batched evaluation: writes the field at x[i] to b[i] (and/or e[i]). Outputs must be
+    /// as long as x. These loop over the single-point API; a derived class may hide them with a
+    /// faster implementation.
+    template<Concept::NumericVector3D T>
+    auto BatchB(std::span<const T> x, std::span<T> b) const -> void;
+    template<Concept::NumericVector3D T>
+    auto BatchE(std::span<const T> x, std::span<T> e) const -> void;
+    template<Concept::NumericVector3D T>
+    auto BatchBE(std::span<const T> x, std::span<T> b, std::span<T> e) const -> void;
 };
 
 } // namespace Mustard::Detector::Field
@@ -24,4 +24,36 @@ constexpr ElectromagneticFieldBase<ADerived>::ElectromagneticFieldBase() {
     static_assert(ElectromagneticField<ADerived>);
 }
 
+template<typename ADerived>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldBase<ADerived>::BatchB(std::span<const T> x, std::span<T> b) const -> void {
+    assert(b.size() == x.size());
+    const auto& self{*static_cast<const ADerived*>(this)};
+    for (std::size_t i{}; i < x.size(); ++i) {
+        b[i] = self.B(x[i]);
+    }
+}
+
+template<typename ADerived>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldBase<ADerived>::BatchE(std::span<const T> x, std::span<T> e) const -> void {
+    assert(e.size() == x.size());
+    const auto& self{*static_cast<const ADerived*>(this)};
+    for (std::size_t i{}; i < x.size(); ++i) {
+        e[i] = self.E(x[i]);
+    }
+}
+
+template<typename ADerived>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldBase<ADerived>::BatchBE(std::span<const T> x, std::span<T> b, std::span<T> e) const -> void {
+    assert(b.size() == x.size() and e.size() == x.size());
+    const auto& self{*static_cast<const ADerived*>(this)};
+    for (std::size_t i{}; i < x.size(); ++i) {
+        auto [bi, ei]{self.BE(x[i])};
+        b[i] = std::move(bi);
+        e[i] = std::move(ei);
+    }
+}
+
 } // namespace Mustard::Detector::Field
@@ -22,6 +22,9 @@
 #include "Mustard/Concept/NumericVector.h++"
 #include "Mustard/Detector/Field/ElectromagneticFieldBase.h++"
 #include "Mustard/Detector/Field/FieldMapSymmetry.h++"
+#include "Mustard/Detector/Field/GridFieldMapRZ.h++"
+#include "Mustard/Detector/Field/internal/BatchInterpolate.h++"
+#include "Mustard/Env/Trace.h++"
 #include "Mustard/Utility/InlineMacro.h++"
 #include "Mustard/Utility/VectorCast.h++"
 
@@ -34,8 +37,11 @@
 #include "muc/ceta_string"
 #include "muc/functional"
 
+#include <cassert>
 #include <concepts>
+#include <cstddef>
 #include <limits>
+#include <span>
 
 namespace Mustard::Detector::Field {
 
@@ -57,7 +63,7 @@ struct BEFieldSI2CLHEP : ATransformation {
 
 /// @brief An electromagnetic field interpolated from data.
 /// Initialization and interpolation are performed by `AFieldMap`.
-/// @tparam ACache A string literal, can be "WithCache" or "NoCache".
+/// @tparam ACache A string literal, can be "WithCache", "CellCache" or "NoCache".
 /// @tparam AFieldMap A field map type, e.g. `EFM::FieldMap3D<T>` or
 /// `EFM::FieldMap3DSymZ<Eigen::Vector<double, .
 /// @note "WithCache" and "NoCache" decides whether field cache will be used.
@@ -67,9 +73,13 @@ struct BEFieldSI2CLHEP : ATransformation {
 ///     Something(field.E(x), field.B(x));
 /// However, if these cases do not matter or you need maximum performace in EB then
 /// "NoCache" would be better.
+/// "CellCache" keeps the node values at the corners of the last grid cell in a per-thread cache
+/// (see `GridFieldMap3D::CellCached`), so any query inside the same cell as the last one on this
+/// thread skips the node loads, e.g. the nearby points of a Runge-Kutta step. It requires an
+/// `AFieldMap` providing `CellCached`, e.g. `GridFieldMap3D`, and is safe to share between threads.
 template<muc::ceta_string ACache = "WithCache",
          typename AFieldMap = EFM::FieldMap3D<Eigen::Vector<double, 6>, double, muc::multidentity, BEFieldSI2CLHEP<>>>
-    requires((ACache == "WithCache" or ACache == "NoCache") and
+    requires((ACache == "WithCache" or ACache == "CellCache" or ACache == "NoCache") and
              std::same_as<typename AFieldMap::CoordinateType, double>)
 class ElectromagneticFieldMap;
 
@@ -90,6 +100,24 @@ public:
     template<Concept::NumericVector3D T>
     auto BE(T x) const -> F<T>;
 
+    /// Batched evaluation bypasses the cache.
+    template<Concept::NumericVector3D T>
+    auto BatchB(std::span<const T> x, std::span<T> b) const -> void;
+    template<Concept::NumericVector3D T>
+    auto BatchE(std::span<const T> x, std::span<T> e) const -> void;
+    template<Concept::NumericVector3D T>
+    auto BatchBE(std::span<const T> x, std::span<T> b, std::span<T> e) const -> void;
+
+private:
+    /// @brief EFM maps return an optional value, others (e.g. `GridFieldMap3D`) the value itself.
+    auto CachedValue() const -> const auto& {
+        if constexpr (requires { *fCache; }) {
+            return *fCache;
+        } else {
+            return fCache;
+        }
+    }
+
 private:
     mutable Eigen::Vector3d fCachedX{std::numeric_limits<double>::quiet_NaN(), 0, 0};
     mutable typename AFieldMap::ValueType fCache;
@@ -111,6 +139,40 @@ public:
     auto E(T x) const -> T;
     template<Concept::NumericVector3D T>
     auto BE(T x) const -> F<T>;
+
+    template<Concept::NumericVector3D T>
+    auto BatchB(std::span<const T> x, std::span<T> b) const -> void;
+    template<Concept::NumericVector3D T>
+    auto BatchE(std::span<const T> x, std::span<T> e) const -> void;
+    template<Concept::NumericVector3D T>
+    auto BatchBE(std::span<const T> x, std::span<T> b, std::span<T> e) const -> void;
+};
+
+template<typename AFieldMap>
+    requires requires(const AFieldMap& map) { map.CellCached(0., 0., 0.); }
+class ElectromagneticFieldMap<"CellCache", AFieldMap> : public ElectromagneticFieldBase<ElectromagneticFieldMap<"CellCache", AFieldMap>>,
+                                                        public AFieldMap {
+private:
+    template<Concept::NumericVector3D T>
+    using F = typename ElectromagneticFieldBase<ElectromagneticFieldMap<"CellCache", AFieldMap>>::template F<T>;
+
+public:
+    using AFieldMap::AFieldMap;
+
+    template<Concept::NumericVector3D T>
+    auto B(T x) const -> T;
+    template<Concept::NumericVector3D T>
+    auto E(T x) const -> T;
+    template<Concept::NumericVector3D T>
+    auto BE(T x) const -> F<T>;
+
+    /// Batched evaluation bypasses the cache.
+    template<Concept::NumericVector3D T>
+    auto BatchB(std::span<const T> x, std::span<T> b) const -> void;
+    template<Concept::NumericVector3D T>
+    auto BatchE(std::span<const T> x, std::span<T> e) const -> void;
+    template<Concept::NumericVector3D T>
+    auto BatchBE(std::span<const T> x, std::span<T> b, std::span<T> e) const -> void;
 };
 
 /// @brief An YZ plane mirror symmetry electromagnetic field interpolated from data.
@@ -155,6 +217,10 @@ template<muc::ceta_string ACache = "WithCache", Concept::MathVector<double, 6> T
 using ElectromagneticFieldMapSymmetryXYZ = ElectromagneticFieldMap<
     ACache, EFM::FieldMap3D<T, double, CoordinateSymmetryXYZ, BEFieldSI2CLHEP<FieldSymmetryXYZ>>>;
 
+/// @brief An axisymmetric electromagnetic field interpolated from (r, z) data, see `GridFieldMapRZ`.
+template<Concept::MathVector<double, 6> T = Eigen::Vector<double, 6>>
+using ElectromagneticFieldMapRZ = ElectromagneticFieldMap<"NoCache", GridFieldMapRZ<T, BEFieldSI2CLHEP<>>>;
+
 } // namespace Mustard::Detector::Field
 
 #include "Mustard/Detector/Field/ElectromagneticFieldMap.inl"
@@ -24,9 +24,10 @@ auto ElectromagneticFieldMap<"WithCache", AFieldMap>::B(T x) const -> T {
     const auto xEigen{VectorCast<Eigen::Vector3d>(x)};
     if (xEigen != fCachedX) {
         fCachedX = xEigen;
+        MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap");
         fCache = (*this)(x[0], x[1], x[2]);
     }
-    const auto& f{*fCache};
+    const auto& f{CachedValue()};
     return {f[0], f[1], f[2]};
 }
 
@@ -36,9 +37,10 @@ auto ElectromagneticFieldMap<"WithCache", AFieldMap>::E(T x) const -> T {
     const auto xEigen{VectorCast<Eigen::Vector3d>(x)};
     if (xEigen != fCachedX) {
         fCachedX = xEigen;
+        MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap");
         fCache = (*this)(x[0], x[1], x[2]);
     }
-    const auto& f{*fCache};
+    const auto& f{CachedValue()};
     return {f[3], f[4], f[5]};
 }
 
@@ -46,15 +48,102 @@ template<typename AFieldMap>
 template<Concept::NumericVector3D T>
 auto ElectromagneticFieldMap<"WithCache", AFieldMap>::BE(T x) const -> F<T> {
     fCachedX = VectorCast<Eigen::Vector3d>(x);
-    fCache = (*this)(x[0], x[1], x[2]);
-    const auto& f{*fCache};
-    return {VectorCast<T>(f[0], f[1], f[2]),
-            VectorCast<T>(f[3], f[4], f[5])};
+    {
+        MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap");
+        fCache = (*this)(x[0], x[1], x[2]);
+    }
+    const auto& f{CachedValue()}; // clang-format off
+    return {{f[0], f[1], f[2]}, {f[3], f[4], f[5]}}; // clang-format on
+}
+
+template<typename AFieldMap>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"WithCache", AFieldMap>::BatchB(std::span<const T> x, std::span<T> b) const -> void {
+    assert(b.size() == x.size());
+    MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap::Batch");
+    internal::BatchInterpolate<AFieldMap>(*this, x, [&](std::size_t i, auto&& f) { b[i] = {f[0], f[1], f[2]}; });
+}
+
+template<typename AFieldMap>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"WithCache", AFieldMap>::BatchE(std::span<const T> x, std::span<T> e) const -> void {
+    assert(e.size() == x.size());
+    MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap::Batch");
+    internal::BatchInterpolate<AFieldMap>(*this, x, [&](std::size_t i, auto&& f) { e[i] = {f[3], f[4], f[5]}; });
+}
+
+template<typename AFieldMap>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"WithCache", AFieldMap>::BatchBE(std::span<const T> x, std::span<T> b, std::span<T> e) const -> void {
+    assert(b.size() == x.size() and e.size() == x.size());
+    MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap::Batch");
+    internal::BatchInterpolate<AFieldMap>(*this, x, [&](std::size_t i, auto&& f) {
+        b[i] = {f[0], f[1], f[2]};
+        e[i] = {f[3], f[4], f[5]};
+    });
+}
+
+template<typename AFieldMap>
+    requires requires(const AFieldMap& map) { map.CellCached(0., 0., 0.); }
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"CellCache", AFieldMap>::B(T x) const -> T {
+    MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap");
+    const auto f{this->CellCached(x[0], x[1], x[2])};
+    return {f[0], f[1], f[2]};
+}
+
+template<typename AFieldMap>
+    requires requires(const AFieldMap& map) { map.CellCached(0., 0., 0.); }
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"CellCache", AFieldMap>::E(T x) const -> T {
+    MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap");
+    const auto f{this->CellCached(x[0], x[1], x[2])};
+    return {f[3], f[4], f[5]};
+}
+
+template<typename AFieldMap>
+    requires requires(const AFieldMap& map) { map.CellCached(0., 0., 0.); }
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"CellCache", AFieldMap>::BE(T x) const -> F<T> {
+    MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap");
+    const auto v{this->CellCached(x[0], x[1], x[2])}; // clang-format off
+    return {{v[0], v[1], v[2]}, {v[3], v[4], v[5]}}; // clang-format on
+}
+
+template<typename AFieldMap>
+    requires requires(const AFieldMap& map) { map.CellCached(0., 0., 0.); }
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"CellCache", AFieldMap>::BatchB(std::span<const T> x, std::span<T> b) const -> void {
+    assert(b.size() == x.size());
+    MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap::Batch");
+    internal::BatchInterpolate<AFieldMap>(*this, x, [&](std::size_t i, auto&& f) { b[i] = {f[0], f[1], f[2]}; });
+}
+
+template<typename AFieldMap>
+    requires requires(const AFieldMap& map) { map.CellCached(0., 0., 0.); }
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"CellCache", AFieldMap>::BatchE(std::span<const T> x, std::span<T> e) const -> void {
+    assert(e.size() == x.size());
+    MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap::Batch");
+    internal::BatchInterpolate<AFieldMap>(*this, x, [&](std::size_t i, auto&& f) { e[i] = {f[3], f[4], f[5]}; });
+}
+
+template<typename AFieldMap>
+    requires requires(const AFieldMap& map) { map.CellCached(0., 0., 0.); }
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"CellCache", AFieldMap>::BatchBE(std::span<const T> x, std::span<T> b, std::span<T> e) const -> void {
+    assert(b.size() == x.size() and e.size() == x.size());
+    MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap::Batch");
+    internal::BatchInterpolate<AFieldMap>(*this, x, [&](std::size_t i, auto&& f) {
+        b[i] = {f[0], f[1], f[2]};
+        e[i] = {f[3], f[4], f[5]};
+    });
 }
 
 template<typename AFieldMap>
 template<Concept::NumericVector3D T>
 auto ElectromagneticFieldMap<"NoCache", AFieldMap>::B(T x) const -> T {
+    MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap");
     const auto f{(*this)(x[0], x[1], x[2])};
     return {f[0], f[1], f[2]};
 }
@@ -62,6 +151,7 @@ auto ElectromagneticFieldMap<"NoCache", AFieldMap>::B(T x) const -> T {
 template<typename AFieldMap>
 template<Concept::NumericVector3D T>
 auto ElectromagneticFieldMap<"NoCache", AFieldMap>::E(T x) const -> T {
+    MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap");
     const auto f{(*this)(x[0], x[1], x[2])};
     return {f[3], f[4], f[5]};
 }
@@ -69,8 +159,36 @@ auto ElectromagneticFieldMap<"NoCache", AFieldMap>::E(T x) const -> T {
 template<typename AFieldMap>
 template<Concept::NumericVector3D T>
 auto ElectromagneticFieldMap<"NoCache", AFieldMap>::BE(T x) const -> F<T> {
+    MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap");
     const auto v{(*this)(x[0], x[1], x[2])}; // clang-format off
     return {{v[0], v[1], v[2]}, {v[3], v[4], v[5]}}; // clang-format on
 }
 
+template<typename AFieldMap>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"NoCache", AFieldMap>::BatchB(std::span<const T> x, std::span<T> b) const -> void {
+    assert(b.size() == x.size());
+    MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap::Batch");
+    internal::BatchInterpolate<AFieldMap>(*this, x, [&](std::size_t i, auto&& f) { b[i] = {f[0], f[1], f[2]}; });
+}
+
+template<typename AFieldMap>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"NoCache", AFieldMap>::BatchE(std::span<const T> x, std::span<T> e) const -> void {
+    assert(e.size() == x.size());
+    MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap::Batch");
+    internal::BatchInterpolate<AFieldMap>(*this, x, [&](std::size_t i, auto&& f) { e[i] = {f[3], f[4], f[5]}; });
+}
+
+template<typename AFieldMap>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"NoCache", AFieldMap>::BatchBE(std::span<const T> x, std::span<T> b, std::span<T> e) const -> void {
+    assert(b.size() == x.size() and e.size() == x.size());
+    MUSTARD_TRACE_SCOPE("Detector::Field::ElectromagneticFieldMap::Batch");
+    internal::BatchInterpolate<AFieldMap>(*this, x, [&](std::size_t i, auto&& f) {
+        b[i] = {f[0], f[1], f[2]};
+        e[i] = {f[3], f[4], f[5]};
+    });
+}
+
 } // namespace Mustard::Detector::Field
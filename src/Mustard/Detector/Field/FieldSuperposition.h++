@@ -0,0 +1,97 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Concept/NumericVector.h++"
+#include "Mustard/Detector/Field/ElectricField.h++"
+#include "Mustard/Detector/Field/ElectromagneticField.h++"
+#include "Mustard/Detector/Field/ElectromagneticFieldBase.h++"
+#include "Mustard/Detector/Field/MagneticField.h++"
+#include "Mustard/Detector/Field/TimeDependentField.h++"
+
+#include "muc/array"
+
+#include <concepts>
+#include <tuple>
+#include <utility>
+
+namespace Mustard::Detector::Field {
+
+namespace internal {
+
+/// @brief A field zero outside the region where `Contains(x)` is true.
+template<typename AField>
+concept FieldWithRegion = requires(const AField& field, muc::array3d x) {
+    { field.Contains(x) } -> std::same_as<bool>;
+};
+
+} // namespace internal
+
+/// @brief Sum of fields, evaluated at (x, t), e.g. static maps with time-dependent weights:
+///     FieldSuperposition{TimeModulatedField{ramp, mapA}, TimeModulatedField{pulse, mapB}}
+/// Costs one evaluation of each field. It is a magnetic (electric) field if all fields are.
+/// Fields having `Contains(x)` (e.g. `BoundedField`, or a `PlacedField` of it) are skipped at
+/// points they do not contain, so a composite of many local fields (magnets placed along a beam
+/// line) only evaluates those covering the point. For a composite queried many times, resampling
+/// it on a grid with `BakeField` makes the cost independent of the number of fields.
+template<ElectromagneticField... AField>
+    requires(sizeof...(AField) > 0)
+class FieldSuperposition : public ElectromagneticFieldBase<FieldSuperposition<AField...>> {
+private:
+    template<Concept::NumericVector3D T>
+    using F = typename ElectromagneticFieldBase<FieldSuperposition<AField...>>::template F<T>;
+
+public:
+    FieldSuperposition(AField... field);
+
+    auto Field() const -> const auto& { return fField; }
+
+    /// @brief Whether any field contains x, if all fields have `Contains`. The sum is zero elsewhere.
+    template<Concept::NumericVector3D T>
+        requires(... and internal::FieldWithRegion<AField>)
+    auto Contains(T x) const -> bool {
+        return std::apply([&](auto&&... field) { return (... or field.Contains(x)); }, fField);
+    }
+
+    template<Concept::NumericVector3D T>
+        requires(... and ElectricField<AField>)
+    static constexpr auto B(T, double = 0) -> T { return {0, 0, 0}; }
+    template<Concept::NumericVector3D T>
+        requires(not(... and ElectricField<AField>))
+    auto B(T x, double t = 0) const -> T;
+    template<Concept::NumericVector3D T>
+        requires(... and MagneticField<AField>)
+    static constexpr auto E(T, double = 0) -> T { return {0, 0, 0}; }
+    template<Concept::NumericVector3D T>
+        requires(not(... and MagneticField<AField>))
+    auto E(T x, double t = 0) const -> T;
+    template<Concept::NumericVector3D T>
+    auto BE(T x, double t = 0) const -> F<T>;
+
+private:
+    template<typename AOneField, Concept::NumericVector3D T>
+    static auto Covers(const AOneField& field, const T& x) -> bool;
+
+private:
+    std::tuple<AField...> fField;
+};
+
+} // namespace Mustard::Detector::Field
+
+#include "Mustard/Detector/Field/FieldSuperposition.inl"
@@ -0,0 +1,95 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Detector::Field {
+
+template<ElectromagneticField... AField>
+    requires(sizeof...(AField) > 0)
+FieldSuperposition<AField...>::FieldSuperposition(AField... field) :
+    ElectromagneticFieldBase<FieldSuperposition<AField...>>{},
+    fField{std::move(field)...} {}
+
+template<ElectromagneticField... AField>
+    requires(sizeof...(AField) > 0)
+template<Concept::NumericVector3D T>
+    requires(not(... and ElectricField<AField>))
+auto FieldSuperposition<AField...>::B(T x, double t) const -> T {
+    T b{0, 0, 0};
+    std::apply([&](auto&&... field) {
+        ([&] {
+            if (not Covers(field, x)) { return; }
+            const auto bi{internal::BAt(field, x, t)};
+            for (int i{}; i < 3; ++i) { b[i] += bi[i]; }
+        }(),
+         ...);
+    },
+               fField);
+    return b;
+}
+
+template<ElectromagneticField... AField>
+    requires(sizeof...(AField) > 0)
+template<Concept::NumericVector3D T>
+    requires(not(... and MagneticField<AField>))
+auto FieldSuperposition<AField...>::E(T x, double t) const -> T {
+    T e{0, 0, 0};
+    std::apply([&](auto&&... field) {
+        ([&] {
+            if (not Covers(field, x)) { return; }
+            const auto ei{internal::EAt(field, x, t)};
+            for (int i{}; i < 3; ++i) { e[i] += ei[i]; }
+        }(),
+         ...);
+    },
+               fField);
+    return e;
+}
+
+template<ElectromagneticField... AField>
+    requires(sizeof...(AField) > 0)
+template<Concept::NumericVector3D T>
+auto FieldSuperposition<AField...>::BE(T x, double t) const -> F<T> {
+    T b{0, 0, 0};
+    T e{0, 0, 0};
+    std::apply([&](auto&&... field) {
+        ([&] {
+            if (not Covers(field, x)) { return; }
+            const auto [bi, ei]{internal::BEAt(field, x, t)};
+            for (int i{}; i < 3; ++i) {
+                b[i] += bi[i];
+                e[i] += ei[i];
+            }
+        }(),
+         ...);
+    },
+               fField);
+    return {std::move(b), std::move(e)};
+}
+
+template<ElectromagneticField... AField>
+    requires(sizeof...(AField) > 0)
+template<typename AOneField, Concept::NumericVector3D T>
+auto FieldSuperposition<AField...>::Covers(const AOneField& field, const T& x) -> bool {
+    if constexpr (internal::FieldWithRegion<AOneField>) {
+        return field.Contains(x);
+    } else {
+        return true;
+    }
+}
+
+} // namespace Mustard::Detector::Field
@@ -0,0 +1,222 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Concept/MathVector.h++"
+#include "Mustard/Concept/NumericVector.h++"
+#include "Mustard/Detector/Field/FieldMapSymmetry.h++"
+#include "Mustard/Detector/Field/GridFieldMapFile.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Extension/MPIX/NodeSharedBuffer.h++"
+#include "Mustard/Math/BFloat16.h++"
+#include "Mustard/Math/Float16.h++"
+#include "Mustard/Utility/InlineMacro.h++"
+#include "Mustard/Utility/PrettyLog.h++"
+#include "Mustard/Utility/VectorDimension.h++"
+
+#include "EFM/FieldMap3D.h++"
+
+#include "fmt/format.h"
+
+#include "mpi.h"
+
+#include "muc/array"
+#include "muc/functional"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Mustard::Detector::Field {
+
+/// @brief Tag of `GridFieldMap3D` constructors that keep nodes in an `MPIX::NodeSharedBuffer`.
+struct NodeShared {};
+
+/// @brief A field map interpolated trilinearly on a regular 3D grid held in memory.
+/// Can be used as `AFieldMap` of `MagneticFieldMap`, `ElectricFieldMap` and
+/// `ElectromagneticFieldMap<"NoCache">` in place of `EFM::FieldMap3D`, with the same
+/// coordinate and field transform hooks (e.g. `CoordinateSymmetryX`, `BFieldSI2CLHEP<FieldSymmetryX>`).
+/// Besides point-by-point interpolation, `Batch` works on blocks of points: it locates the cells
+/// of a whole block and prefetches their corners first, then blends corners component by
+/// component, which hides the memory latency of grids larger than the cache.
+/// Outside the grid, the value at the nearest boundary point is returned.
+/// A grid can be saved to a binary field map file (see `GridFieldMapFile`) and loaded through
+/// a memory mapping, which costs no parsing. E.g. to convert a map read from ROOT or text,
+/// sample it on the grid and save:
+///     GridFieldMap3D<Eigen::Vector3d, CoordinateSymmetryX>{x0, x1, n, efmMap}.Save("B.mfm", "mm", "T");
+/// and load it in the application with
+///     MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d, CoordinateSymmetryX, BFieldSI2CLHEP<FieldSymmetryX>>> field{"B.mfm", "mm", "T"};
+/// @tparam T node value type, e.g. `Eigen::Vector3d` or `Eigen::Vector<double, 6>`
+/// @tparam AStorage node component storage type: `double`, `float`, `Math::BFloat16` or
+/// `Math::Float16`. Interpolation is always done in double. 16-bit storage keeps each component
+/// divided by its maximum magnitude M over the grid (the per-map scale). Trilinear weights are
+/// non-negative and sum to 1, so the storage error of an interpolated component is bounded by the
+/// rounding error of the cell corners, i.e. with F the largest corner magnitude of the cell:
+///  - `float`: 2^-24 F,
+///  - `Math::BFloat16`: 2^-8 F,
+///  - `Math::Float16`: 2^-11 F + 2^-25 M.
+/// Node memory and bandwidth are 1/2 (`float`) or 1/4 (16-bit) of `double`.
+template<Concept::MathVector<double> T,
+         typename ACoordinateTransform = muc::multidentity,
+         typename AFieldTransform = EFM::Identity,
+         typename AStorage = double>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+class GridFieldMap3D {
+public:
+    using CoordinateType = double;
+    using ValueType = T;
+
+public:
+    /// @param x0 lower grid corner (in transformed coordinates)
+    /// @param x1 upper grid corner (in transformed coordinates)
+    /// @param n number of nodes along each axis, at least 2
+    /// @param node node values, value at node (i, j, k) is node[(i * n[1] + j) * n[2] + k]
+    GridFieldMap3D(muc::array3d x0, muc::array3d x1, std::array<int, 3> n, std::vector<T> node);
+    /// @brief Samples f(x, y, z) at grid nodes. f is called with transformed coordinates and
+    /// returns node values, i.e. values before the field transform.
+    template<std::invocable<double, double, double> F>
+        requires std::convertible_to<std::invoke_result_t<F&, double, double, double>, T>
+    GridFieldMap3D(muc::array3d x0, muc::array3d x1, std::array<int, 3> n, F&& f);
+    /// @brief Same as above, but nodes are kept in memory shared by all processes on a node (see
+    /// `MPIX::NodeSharedBuffer`), so a node holds one copy of the grid instead of one per process.
+    /// node is significant on node master only. Collective on `MPIEnv::CommNode()`, and so is the
+    /// destruction of the last copy of the map.
+    GridFieldMap3D(NodeShared, muc::array3d x0, muc::array3d x1, std::array<int, 3> n, std::vector<T> node);
+    /// @brief Same as above, but only node master samples f.
+    template<std::invocable<double, double, double> F>
+        requires std::convertible_to<std::invoke_result_t<F&, double, double, double>, T>
+    GridFieldMap3D(NodeShared, muc::array3d x0, muc::array3d x1, std::array<int, 3> n, F&& f);
+    /// @brief Maps a binary field map file. Node data is read from the page cache on demand.
+    /// @param coordinateUnit,fieldUnit expected units, checked against the file
+    /// @param verify verify the node checksum, which reads the whole file
+    /// @exception Throw a std::runtime_error if the file is invalid or does not match the
+    /// storage type, dimension, coordinate symmetry or units of this map.
+    GridFieldMap3D(const std::filesystem::path& file, std::string_view coordinateUnit, std::string_view fieldUnit, bool verify = false);
+
+    /// @brief Writes the grid to a binary field map file, see `GridFieldMapFile`.
+    auto Save(const std::filesystem::path& file, std::string_view coordinateUnit, std::string_view fieldUnit) const -> void;
+
+    auto X0() const -> const auto& { return fX0; }
+    auto X1() const -> const auto& { return fX1; }
+    auto N() const -> const auto& { return fN; }
+    /// @brief Stored node components, node (i, j, k) component c at ((i * n[1] + j) * n[2] + k) * dimension + c.
+    auto Node() const -> std::span<const AStorage> { return fNode; }
+    /// @brief Component-wise scale of stored nodes (1 unless stored in 16 bits).
+    auto Scale() const -> const auto& { return fScale; }
+
+    auto operator()(double x, double y, double z) const -> T;
+    /// @brief Same as operator(), but keeps the node values at the corners of the last cell in a
+    /// per-thread cache, so that a query in the same cell as the previous one on this thread (e.g.
+    /// the stages of a Runge-Kutta step) only recomputes the weights. One cell is cached per thread
+    /// and per map type, so alternating between maps of the same type defeats the cache.
+    /// It pays off with 16-bit storage, where it also saves decoding. With double storage, loading
+    /// the corners of a cell that is still in L1 costs about as much as reading the cache.
+    auto CellCached(double x, double y, double z) const -> T;
+    /// @brief Batched interpolation. Calls Store(i, value) with the field value at x[i], in order.
+    template<Concept::NumericVector3D X, std::invocable<std::size_t, T> S>
+    auto Batch(std::span<const X> x, S&& Store) const -> void;
+
+private:
+    struct Grid {
+        muc::array3d x0;
+        muc::array3d x1;
+        std::array<int, 3> n;
+        std::shared_ptr<const void> owner;
+        std::span<const AStorage> node;
+        std::array<double, VectorDimension<T>> scale;
+    };
+
+    struct Cell {
+        std::ptrdiff_t index; // of the first node component, in units of AStorage
+        double u;
+        double v;
+        double w;
+    };
+
+private:
+    explicit GridFieldMap3D(Grid grid);
+
+    static auto Encode(muc::array3d x0, muc::array3d x1, std::array<int, 3> n, const std::vector<T>& node) -> Grid;
+    template<std::invocable<> F>
+    static auto EncodeNodeShared(muc::array3d x0, muc::array3d x1, std::array<int, 3> n, F&& Load) -> Grid;
+    static auto Quantize(const std::vector<T>& node, std::span<AStorage> storage) -> std::array<double, VectorDimension<T>>;
+    static auto Open(const std::filesystem::path& file, std::string_view coordinateUnit, std::string_view fieldUnit, bool verify) -> Grid;
+    template<typename F>
+    static auto Sample(muc::array3d x0, muc::array3d x1, std::array<int, 3> n, F& f) -> std::vector<T>;
+
+    MUSTARD_ALWAYS_INLINE auto Locate(double x, double y, double z) const -> Cell;
+    MUSTARD_ALWAYS_INLINE auto Corner(std::ptrdiff_t index) const -> std::array<double, 8>;
+    MUSTARD_ALWAYS_INLINE static auto Blend(const std::array<double, 8>& f, double u, double v, double w) -> double;
+    MUSTARD_ALWAYS_INLINE static auto Decode(AStorage value) -> double;
+    MUSTARD_ALWAYS_INLINE static auto Prefetch(const AStorage* address) -> void;
+
+private:
+    muc::array3d fX0;
+    muc::array3d fX1;
+    std::array<int, 3> fN;
+    muc::array3d fInverseSpacing;
+    std::ptrdiff_t fStrideX; // in units of AStorage
+    std::ptrdiff_t fStrideY; // in units of AStorage
+    std::shared_ptr<const void> fNodeOwner; // node memory or file mapping, shared by copies
+    std::span<const AStorage> fNode;
+    std::array<double, VectorDimension<T>> fScale;
+    [[no_unique_address]] ACoordinateTransform fCoordinateTransform;
+    [[no_unique_address]] AFieldTransform fFieldTransform;
+    std::uint64_t fCacheID; // identifies node data in per-thread cell caches, shared by copies
+
+    static std::atomic<std::uint64_t> fgNCacheID;
+
+    static constexpr auto fgDimension{static_cast<int>(VectorDimension<T>)};
+    static_assert(VectorDimension<T> <= std::tuple_size_v<decltype(GridFieldMapFile::Header::scale)>,
+                  "GridFieldMapFile stores scales of at most 6 field components");
+    static constexpr auto fgScaled{not std::floating_point<AStorage>};
+    static constexpr std::size_t fgBlockSize{16};
+    static constexpr std::size_t fgBlockingThreshold{4 << 20};
+    static constexpr auto fgStorageTag{std::same_as<AStorage, double>         ? GridFieldMapFile::Storage::Double :
+                                       std::same_as<AStorage, float>          ? GridFieldMapFile::Storage::Float :
+                                       std::same_as<AStorage, Math::BFloat16> ? GridFieldMapFile::Storage::BFloat16 :
+                                                                                GridFieldMapFile::Storage::Float16};
+    static constexpr std::string_view fgSymmetryTag{std::same_as<ACoordinateTransform, muc::multidentity>     ? "None" :
+                                                    std::same_as<ACoordinateTransform, CoordinateSymmetryX>   ? "X" :
+                                                    std::same_as<ACoordinateTransform, CoordinateSymmetryY>   ? "Y" :
+                                                    std::same_as<ACoordinateTransform, CoordinateSymmetryZ>   ? "Z" :
+                                                    std::same_as<ACoordinateTransform, CoordinateSymmetryXY>  ? "XY" :
+                                                    std::same_as<ACoordinateTransform, CoordinateSymmetryXZ>  ? "XZ" :
+                                                    std::same_as<ACoordinateTransform, CoordinateSymmetryYZ>  ? "YZ" :
+                                                    std::same_as<ACoordinateTransform, CoordinateSymmetryXYZ> ? "XYZ" :
+                                                                                                                "Custom"};
+};
+
+} // namespace Mustard::Detector::Field
+
+#include "Mustard/Detector/Field/GridFieldMap3D.inl"
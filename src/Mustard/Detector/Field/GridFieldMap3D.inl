@@ -0,0 +1,352 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Detector::Field {
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+std::atomic<std::uint64_t> GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::fgNCacheID{};
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::GridFieldMap3D(muc::array3d x0, muc::array3d x1, std::array<int, 3> n, std::vector<T> node) :
+    GridFieldMap3D{Encode(x0, x1, n, node)} {}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+template<std::invocable<double, double, double> F>
+    requires std::convertible_to<std::invoke_result_t<F&, double, double, double>, T>
+GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::GridFieldMap3D(muc::array3d x0, muc::array3d x1, std::array<int, 3> n, F&& f) :
+    GridFieldMap3D{x0, x1, n, Sample(x0, x1, n, f)} {}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::GridFieldMap3D(NodeShared, muc::array3d x0, muc::array3d x1, std::array<int, 3> n, std::vector<T> node) :
+    GridFieldMap3D{EncodeNodeShared(x0, x1, n, [&] { return std::move(node); })} {}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+template<std::invocable<double, double, double> F>
+    requires std::convertible_to<std::invoke_result_t<F&, double, double, double>, T>
+GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::GridFieldMap3D(NodeShared, muc::array3d x0, muc::array3d x1, std::array<int, 3> n, F&& f) :
+    GridFieldMap3D{EncodeNodeShared(x0, x1, n, [&] { return Sample(x0, x1, n, f); })} {}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::GridFieldMap3D(const std::filesystem::path& file, std::string_view coordinateUnit, std::string_view fieldUnit, bool verify) :
+    GridFieldMap3D{Open(file, coordinateUnit, fieldUnit, verify)} {}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+auto GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::Save(const std::filesystem::path& file, std::string_view coordinateUnit, std::string_view fieldUnit) const -> void {
+    GridFieldMapFile::Header header{};
+    header.storage = fgStorageTag;
+    header.dimension = fgDimension;
+    header.symmetry = GridFieldMapFile::Text(fgSymmetryTag);
+    header.coordinateUnit = GridFieldMapFile::Text(coordinateUnit);
+    header.fieldUnit = GridFieldMapFile::Text(fieldUnit);
+    header.n = fN;
+    header.x0 = fX0;
+    header.x1 = fX1;
+    std::ranges::copy(fScale, header.scale.begin());
+    GridFieldMapFile::Write(file, header, std::as_bytes(fNode));
+}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+auto GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::operator()(double x, double y, double z) const -> T {
+    const auto [index, u, v, w]{Locate(x, y, z)};
+    T f;
+    for (int c{}; c < fgDimension; ++c) {
+        f[c] = Blend(Corner(index + c), u, v, w) * fScale[c];
+    }
+    return fFieldTransform(x, y, z, std::move(f));
+}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+auto GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::CellCached(double x, double y, double z) const -> T {
+    thread_local struct {
+        std::uint64_t owner;
+        std::ptrdiff_t index;
+        std::array<std::array<double, 8>, fgDimension> corner; // of each component
+    } cache{};
+    const auto [index, u, v, w]{Locate(x, y, z)};
+    T f;
+    if (cache.owner != fCacheID or cache.index != index) {
+        for (int c{}; c < fgDimension; ++c) {
+            const auto corner{Corner(index + c)};
+            f[c] = Blend(corner, u, v, w) * fScale[c];
+            cache.corner[c] = corner;
+        }
+        cache.owner = fCacheID;
+        cache.index = index;
+    } else {
+        for (int c{}; c < fgDimension; ++c) {
+            f[c] = Blend(cache.corner[c], u, v, w) * fScale[c];
+        }
+    }
+    return fFieldTransform(x, y, z, std::move(f));
+}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+template<Concept::NumericVector3D X, std::invocable<std::size_t, T> S>
+auto GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::Batch(std::span<const X> x, S&& Store) const -> void {
+    // a cache-resident grid gains nothing from blocking
+    if (fNode.size() * sizeof(AStorage) < fgBlockingThreshold) {
+        for (std::size_t i{}; i < x.size(); ++i) {
+            Store(i, (*this)(x[i][0], x[i][1], x[i][2]));
+        }
+        return;
+    }
+    std::array<std::ptrdiff_t, fgBlockSize> index{};
+    std::array<double, fgBlockSize> u{};
+    std::array<double, fgBlockSize> v{};
+    std::array<double, fgBlockSize> w{};
+    std::array<std::array<double, fgBlockSize>, fgDimension> value;
+    for (std::size_t begin{}; begin < x.size(); begin += fgBlockSize) {
+        const auto size{std::min(fgBlockSize, x.size() - begin)};
+        for (std::size_t l{}; l < size; ++l) {
+            const auto& xl{x[begin + l]};
+            const auto cell{Locate(xl[0], xl[1], xl[2])};
+            std::tie(index[l], u[l], v[l], w[l]) = std::tie(cell.index, cell.u, cell.v, cell.w);
+            // request all corners of the block before any is used
+            for (auto offset : {std::ptrdiff_t{}, fStrideY, fStrideX, fStrideX + fStrideY}) {
+                Prefetch(fNode.data() + cell.index + offset);
+                Prefetch(fNode.data() + cell.index + offset + 2 * fgDimension - 1);
+            }
+        }
+        // component-major, so that each pass gathers one component of all lanes
+        for (int c{}; c < fgDimension; ++c) {
+            for (std::size_t l{}; l < fgBlockSize; ++l) {
+                value[c][l] = Blend(Corner(index[l] + c), u[l], v[l], w[l]) * fScale[c];
+            }
+        }
+        for (std::size_t l{}; l < size; ++l) {
+            T f;
+            for (int c{}; c < fgDimension; ++c) {
+                f[c] = value[c][l];
+            }
+            const auto& xl{x[begin + l]};
+            Store(begin + l, fFieldTransform(xl[0], xl[1], xl[2], std::move(f)));
+        }
+    }
+}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::GridFieldMap3D(Grid grid) :
+    fX0{grid.x0},
+    fX1{grid.x1},
+    fN{grid.n},
+    fInverseSpacing{},
+    fStrideX{static_cast<std::ptrdiff_t>(grid.n[1]) * grid.n[2] * fgDimension},
+    fStrideY{static_cast<std::ptrdiff_t>(grid.n[2]) * fgDimension},
+    fNodeOwner{std::move(grid.owner)},
+    fNode{grid.node},
+    fScale{grid.scale},
+    fCoordinateTransform{},
+    fFieldTransform{},
+    fCacheID{++fgNCacheID} {
+    for (int a{}; a < 3; ++a) {
+        if (fN[a] < 2) { throw std::invalid_argument{PrettyException("Field map grid requires at least 2 nodes per axis")}; }
+        if (not(fX0[a] < fX1[a])) { throw std::invalid_argument{PrettyException("Field map grid requires x0 < x1")}; }
+        fInverseSpacing[a] = (fN[a] - 1) / (fX1[a] - fX0[a]);
+    }
+    if (fNode.size() != static_cast<std::size_t>(fN[0]) * fStrideX) {
+        throw std::invalid_argument{PrettyException("Number of field map nodes does not match the grid")};
+    }
+}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+auto GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::Encode(muc::array3d x0, muc::array3d x1, std::array<int, 3> n, const std::vector<T>& node) -> Grid {
+    const auto storage{std::make_shared<std::vector<AStorage>>(node.size() * fgDimension)};
+    const auto scale{Quantize(node, *storage)};
+    const std::span<const AStorage> data{*storage};
+    return {x0, x1, n, storage, data, scale};
+}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+template<std::invocable<> F>
+auto GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::EncodeNodeShared(muc::array3d x0, muc::array3d x1, std::array<int, 3> n, F&& Load) -> Grid {
+    const auto nNode{static_cast<std::size_t>(std::max(n[0], 0)) * std::max(n[1], 0) * std::max(n[2], 0)};
+    std::array<double, fgDimension> scale;
+    const auto storage{std::make_shared<const MPIX::NodeSharedBuffer<AStorage>>(
+        nNode * fgDimension,
+        [&](std::span<AStorage> data) {
+            const auto node{Load()};
+            if (node.size() != nNode) { throw std::invalid_argument{PrettyException("Number of field map nodes does not match the grid")}; }
+            scale = Quantize(node, data);
+        })};
+    // node master has computed the scale
+    MPI_Bcast(scale.data(),                        // buffer
+              fgDimension,                         // count
+              MPI_DOUBLE,                          // datatype
+              0,                                   // root
+              Env::MPIEnv::Instance().CommNode()); // comm
+    return {x0, x1, n, storage, storage->Span(), scale};
+}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+auto GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::Quantize(const std::vector<T>& node, std::span<AStorage> storage) -> std::array<double, VectorDimension<T>> {
+    std::array<double, fgDimension> scale;
+    std::ranges::fill(scale, 1);
+    if constexpr (fgScaled) {
+        std::array<double, fgDimension> max{};
+        for (auto&& f : node) {
+            for (int c{}; c < fgDimension; ++c) {
+                max[c] = std::max(max[c], std::abs(f[c]));
+            }
+        }
+        for (int c{}; c < fgDimension; ++c) {
+            if (max[c] > 0) { scale[c] = max[c]; }
+        }
+    }
+    auto s{storage.begin()};
+    for (auto&& f : node) {
+        for (int c{}; c < fgDimension; ++c) {
+            *s++ = static_cast<AStorage>(f[c] / scale[c]);
+        }
+    }
+    return scale;
+}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+auto GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::Open(const std::filesystem::path& file, std::string_view coordinateUnit, std::string_view fieldUnit, bool verify) -> Grid {
+    const GridFieldMapFile mapped{file, verify};
+    const auto& header{mapped.GetHeader()};
+    const auto Mismatch{[&file](std::string_view what, auto&& expected, auto&& found) {
+        throw std::runtime_error{PrettyException(fmt::format("Field map file '{}' has {} {}, expected {}", file.generic_string(), what, found, expected))};
+    }};
+    if (header.storage != fgStorageTag) { Mismatch("storage type", static_cast<int>(fgStorageTag), static_cast<int>(header.storage)); }
+    if (header.dimension != fgDimension) { Mismatch("dimension", fgDimension, header.dimension); }
+    if (header.Symmetry() != fgSymmetryTag) { Mismatch("coordinate symmetry", fgSymmetryTag, header.Symmetry()); }
+    if (header.CoordinateUnit() != coordinateUnit) { Mismatch("coordinate unit", coordinateUnit, header.CoordinateUnit()); }
+    if (header.FieldUnit() != fieldUnit) { Mismatch("field unit", fieldUnit, header.FieldUnit()); }
+    const auto node{mapped.Node()};
+    if (node.size() % sizeof(AStorage) != 0) { Mismatch("node data size", "a multiple of the storage size", node.size()); }
+    std::array<double, fgDimension> scale;
+    std::copy_n(header.scale.cbegin(), fgDimension, scale.begin());
+    // node data is aligned in the file, and the mapping is page-aligned
+    const std::span data{reinterpret_cast<const AStorage*>(node.data()), node.size() / sizeof(AStorage)};
+    return {header.x0, header.x1, header.n, mapped.Mapping(), data, scale};
+}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+template<typename F>
+auto GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::Sample(muc::array3d x0, muc::array3d x1, std::array<int, 3> n, F& f) -> std::vector<T> {
+    if (std::ranges::any_of(n, [](auto ni) { return ni < 2; })) { return {}; } // rejected by the constructor
+    std::vector<T> node;
+    node.reserve(static_cast<std::size_t>(n[0]) * n[1] * n[2]);
+    for (int i{}; i < n[0]; ++i) {
+        const auto x{x0[0] + (x1[0] - x0[0]) * i / (n[0] - 1)};
+        for (int j{}; j < n[1]; ++j) {
+            const auto y{x0[1] + (x1[1] - x0[1]) * j / (n[1] - 1)};
+            for (int k{}; k < n[2]; ++k) {
+                const auto z{x0[2] + (x1[2] - x0[2]) * k / (n[2] - 1)};
+                node.push_back(f(x, y, z));
+            }
+        }
+    }
+    return node;
+}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+MUSTARD_ALWAYS_INLINE auto GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::Locate(double x, double y, double z) const -> Cell {
+    const auto [xt, yt, zt]{fCoordinateTransform(x, y, z)};
+    const std::array<double, 3> xg{xt, yt, zt};
+    std::array<int, 3> i;
+    std::array<double, 3> t;
+    for (int a{}; a < 3; ++a) {
+        t[a] = std::clamp((xg[a] - fX0[a]) * fInverseSpacing[a], 0., fN[a] - 1.);
+        i[a] = std::min(static_cast<int>(t[a]), fN[a] - 2);
+        t[a] -= i[a];
+    }
+    return {i[0] * fStrideX + i[1] * fStrideY + i[2] * fgDimension, t[0], t[1], t[2]};
+}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+MUSTARD_ALWAYS_INLINE auto GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::Corner(std::ptrdiff_t index) const -> std::array<double, 8> {
+    const auto node{fNode.data() + index};
+    return {Decode(node[0]), Decode(node[fgDimension]),
+            Decode(node[fStrideY]), Decode(node[fStrideY + fgDimension]),
+            Decode(node[fStrideX]), Decode(node[fStrideX + fgDimension]),
+            Decode(node[fStrideX + fStrideY]), Decode(node[fStrideX + fStrideY + fgDimension])};
+}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+MUSTARD_ALWAYS_INLINE auto GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::Blend(const std::array<double, 8>& f, double u, double v, double w) -> double {
+    const auto Lerp{[](double a, double b, double t) { return a + t * (b - a); }};
+    const auto f00{Lerp(f[0], f[1], w)};
+    const auto f01{Lerp(f[2], f[3], w)};
+    const auto f10{Lerp(f[4], f[5], w)};
+    const auto f11{Lerp(f[6], f[7], w)};
+    return Lerp(Lerp(f00, f01, v), Lerp(f10, f11, v), u);
+}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+MUSTARD_ALWAYS_INLINE auto GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::Decode(AStorage value) -> double {
+    if constexpr (std::floating_point<AStorage>) {
+        return value;
+    } else {
+        return static_cast<float>(value);
+    }
+}
+
+template<Concept::MathVector<double> T, typename ACoordinateTransform, typename AFieldTransform, typename AStorage>
+    requires(std::same_as<AStorage, double> or std::same_as<AStorage, float> or
+             std::same_as<AStorage, Math::BFloat16> or std::same_as<AStorage, Math::Float16>)
+MUSTARD_ALWAYS_INLINE auto GridFieldMap3D<T, ACoordinateTransform, AFieldTransform, AStorage>::Prefetch(const AStorage* address) -> void {
+#if defined __GNUC__ or defined __clang__
+    __builtin_prefetch(address);
+#else
+    static_cast<void>(address);
+#endif
+}
+
+} // namespace Mustard::Detector::Field
@@ -0,0 +1,127 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Detector/Field/GridFieldMapFile.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Utility/PrettyLog.h++"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace Mustard::Detector::Field {
+
+GridFieldMapFile::GridFieldMapFile(const std::filesystem::path& path, bool verify) :
+    fMapping{std::make_shared<const MappedFile>(path)},
+    fHeader{} {
+    const auto Fail{[&path](std::string_view what) {
+        throw std::runtime_error{PrettyException(fmt::format("'{}' is not a valid field map file ({})", path.generic_string(), what))};
+    }};
+    const auto data{fMapping->Data()};
+    if (data.size() < sizeof(Header)) { Fail("too short"); }
+    std::memcpy(&fHeader, data.data(), sizeof(Header));
+    if (fHeader.magic != fgMagic) { Fail("unknown format"); }
+    if (fHeader.version != fgVersion) { Fail(fmt::format("unsupported version {}", fHeader.version)); }
+    if (fHeader.byteOrder != fgByteOrder) { Fail("written on a machine of different byte order"); }
+    if (fHeader.headerChecksum != Checksum(data.first(offsetof(Header, headerChecksum)))) { Fail("corrupted header"); }
+    if (fHeader.nodeOffset % fgNodeAlignment != 0 or fHeader.nodeOffset < sizeof(Header) or
+        data.size() != fHeader.nodeOffset + fHeader.nodeSize) { Fail("truncated"); }
+    if (verify and fHeader.nodeChecksum != Checksum(Node())) { Fail("corrupted node data"); }
+}
+
+auto GridFieldMapFile::Node() const -> std::span<const std::byte> {
+    return fMapping->Data().subspan(fHeader.nodeOffset, fHeader.nodeSize);
+}
+
+auto GridFieldMapFile::Write(const std::filesystem::path& path, Header header, std::span<const std::byte> node) -> void {
+    header.magic = fgMagic;
+    header.version = fgVersion;
+    header.byteOrder = fgByteOrder;
+    header.nodeOffset = (sizeof(Header) + fgNodeAlignment - 1) / fgNodeAlignment * fgNodeAlignment;
+    header.nodeSize = node.size();
+    header.nodeChecksum = Checksum(node);
+    header.headerChecksum = Checksum(std::as_bytes(std::span{&header, 1}).first(offsetof(Header, headerChecksum)));
+
+    // unique per process, so that concurrent writers never share a temporary file
+    std::minstd_rand random;
+    if (std::random_device randomDevice;
+        randomDevice.entropy() > 0) {
+        random.seed(randomDevice());
+    } else {
+        random.seed(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    }
+    auto temporary{path};
+    temporary.concat(fmt::format(".{:x}", random()));
+    if (Env::MPIEnv::Available()) {
+        temporary.concat(fmt::format(".mpi{}", Env::MPIEnv::Instance().CommWorldRank()));
+    }
+    temporary.concat(".tmp");
+    const auto file{std::fopen(temporary.generic_string().c_str(), "wbx")};
+    if (file == nullptr) {
+        throw std::runtime_error{PrettyException(fmt::format("Cannot open '{}' for writing", temporary.generic_string()))};
+    }
+    const std::vector<char> padding(header.nodeOffset - sizeof(Header));
+    const auto written{std::fwrite(&header, sizeof(Header), 1, file) == 1 and
+                       std::fwrite(padding.data(), 1, padding.size(), file) == padding.size() and
+                       std::fwrite(node.data(), 1, node.size(), file) == node.size()};
+    if (std::fclose(file) != 0 or not written) {
+        std::error_code muteRemoveError;
+        std::filesystem::remove(temporary, muteRemoveError);
+        throw std::runtime_error{PrettyException(fmt::format("Failed to write '{}'", temporary.generic_string()))};
+    }
+    std::filesystem::rename(temporary, path);
+}
+
+auto GridFieldMapFile::Text(std::string_view text) -> std::array<char, 16> {
+    std::array<char, 16> field{};
+    if (text.size() >= field.size()) {
+        throw std::invalid_argument{PrettyException(fmt::format("'{}' is too long for a field map file header (max. {} characters)", text, field.size() - 1))};
+    }
+    std::ranges::copy(text, field.begin());
+    return field;
+}
+
+auto GridFieldMapFile::Text(const std::array<char, 16>& text) -> std::string_view {
+    return {text.data(), static_cast<std::size_t>(std::ranges::find(text, '\0') - text.cbegin())};
+}
+
+auto GridFieldMapFile::Checksum(std::span<const std::byte> data) -> std::uint64_t {
+    // FNV-1a on 64-bit words, with 4 independent lanes to keep up with memory bandwidth
+    constexpr std::uint64_t prime{0x100000001b3};
+    std::array<std::uint64_t, 4> lane{0xcbf29ce484222325, 0x84222325cbf29ce4, 0x9ce484222325cbf2, 0x2325cbf29ce48422};
+    std::size_t i{};
+    for (; i + sizeof(lane) <= data.size(); i += sizeof(lane)) {
+        std::array<std::uint64_t, 4> word;
+        std::memcpy(word.data(), data.data() + i, sizeof(word));
+        for (int l{}; l < 4; ++l) { lane[l] = (lane[l] ^ word[l]) * prime; }
+    }
+    auto hash{data.size() * prime};
+    for (auto&& l : lane) { hash = (hash ^ l) * prime; }
+    for (; i < data.size(); ++i) { hash = (hash ^ std::to_integer<std::uint64_t>(data[i])) * prime; }
+    return hash ^ hash >> 32;
+}
+
+} // namespace Mustard::Detector::Field
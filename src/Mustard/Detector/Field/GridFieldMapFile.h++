@@ -0,0 +1,107 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Utility/MappedFile.h++"
+
+#include "muc/array"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+namespace Mustard::Detector::Field {
+
+/// @brief Binary field map file of `GridFieldMap3D`, read through a memory mapping, so that
+/// loading costs no parsing and processes on a node share the node data in the page cache.
+/// Layout: a `Header`, zero padding up to `Header::nodeOffset`, then the node components exactly
+/// as stored in memory (native byte order, checked on read).
+class GridFieldMapFile {
+public:
+    enum struct Storage : std::uint8_t {
+        Double,
+        Float,
+        BFloat16,
+        Float16
+    };
+
+    struct Header {
+        std::array<char, 8> magic;
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint32_t nodeOffset; // in bytes, a multiple of fgNodeAlignment
+        Storage storage;
+        std::uint8_t dimension;        // number of components per node
+        std::array<char, 2> reserved0; // zero
+        std::array<char, 16> symmetry; // "None", "X", "XY", ..., or "Custom"
+        std::array<char, 16> coordinateUnit;
+        std::array<char, 16> fieldUnit;
+        std::array<std::int32_t, 3> n;
+        std::array<char, 4> reserved1; // zero
+        muc::array3d x0;
+        muc::array3d x1;
+        std::array<double, 6> scale; // of each component, see GridFieldMap3D
+        std::uint64_t nodeSize;      // in bytes
+        std::uint64_t nodeChecksum;
+        std::uint64_t headerChecksum; // of all bytes above
+
+        auto Symmetry() const -> std::string_view { return Text(symmetry); }
+        auto CoordinateUnit() const -> std::string_view { return Text(coordinateUnit); }
+        auto FieldUnit() const -> std::string_view { return Text(fieldUnit); }
+    };
+    static_assert(std::is_trivially_copyable_v<Header> and sizeof(Header) == 208); // no implicit padding
+
+public:
+    /// @brief Maps the file and validates its header. The node checksum is verified only if
+    /// verify is true, since that reads the whole file.
+    /// @exception Throw a std::runtime_error if the file is not a valid field map file.
+    explicit GridFieldMapFile(const std::filesystem::path& path, bool verify = false);
+
+    auto GetHeader() const -> const auto& { return fHeader; }
+    auto Node() const -> std::span<const std::byte>;
+    /// @brief The mapping, which must outlive any use of Node().
+    auto Mapping() const -> const auto& { return fMapping; }
+
+    /// @brief Writes header and node data. Fills magic, version, byte order, node offset,
+    /// node size and checksums of the header. The file is written to a temporary path unique to
+    /// the process first and renamed, so that readers never see a partially written file and
+    /// concurrent writers of the same path never interleave.
+    static auto Write(const std::filesystem::path& path, Header header, std::span<const std::byte> node) -> void;
+    /// @brief Converts a short string (e.g. a unit) to a header field.
+    /// @exception Throw a std::invalid_argument if it does not fit.
+    static auto Text(std::string_view text) -> std::array<char, 16>;
+    static auto Text(const std::array<char, 16>& text) -> std::string_view;
+    static auto Checksum(std::span<const std::byte> data) -> std::uint64_t;
+
+private:
+    std::shared_ptr<const MappedFile> fMapping;
+    Header fHeader;
+
+    static constexpr std::array<char, 8> fgMagic{'M', 'U', 'S', 'T', 'F', 'M', 'A', 'P'};
+    static constexpr std::uint32_t fgVersion{1};
+    static constexpr std::uint32_t fgByteOrder{0x01020304};
+    static constexpr std::size_t fgNodeAlignment{64};
+};
+
+} // namespace Mustard::Detector::Field
@@ -0,0 +1,97 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Concept/MathVector.h++"
+#include "Mustard/Utility/InlineMacro.h++"
+#include "Mustard/Utility/PrettyLog.h++"
+#include "Mustard/Utility/VectorDimension.h++"
+
+#include "EFM/FieldMap3D.h++"
+
+#include "muc/array"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Mustard::Detector::Field {
+
+/// @brief An axisymmetric field map interpolated bilinearly on a regular (r, z) grid held in
+/// memory, with the symmetry axis along z. Can be used as `AFieldMap` of `MagneticFieldMap`,
+/// `ElectricFieldMap` and `ElectromagneticFieldMap<"NoCache">`, see e.g. `MagneticFieldMapRZ`.
+/// Nodes hold cylindrical components (r, phi, z), which are rotated to Cartesian (x, y, z) at the
+/// queried azimuth before the field transform. By symmetry the transverse components vanish on
+/// the axis, so they are set to zero at nodes on r = 0; the interpolated transverse field then
+/// goes to zero linearly towards the axis, and the azimuth is never needed on the axis.
+/// Outside the grid, the value at the nearest boundary point is returned.
+/// @tparam T node value type, (Fr, Fphi, Fz) e.g. `Eigen::Vector3d`, or
+/// (Br, Bphi, Bz, Er, Ephi, Ez) e.g. `Eigen::Vector<double, 6>`
+template<Concept::MathVector<double> T, typename AFieldTransform = EFM::Identity>
+    requires(VectorDimension<T> == 3 or VectorDimension<T> == 6)
+class GridFieldMapRZ {
+public:
+    using CoordinateType = double;
+    using ValueType = T;
+
+public:
+    /// @param x0 lower grid corner (r0, z0), r0 >= 0
+    /// @param x1 upper grid corner (r1, z1)
+    /// @param n number of nodes along r and z, at least 2
+    /// @param node node values, value at node (i, k) is node[i * n[1] + k]
+    GridFieldMapRZ(muc::array2d x0, muc::array2d x1, std::array<int, 2> n, std::vector<T> node);
+    /// @brief Samples f(r, z) at grid nodes. f returns node values, i.e. cylindrical components
+    /// before the field transform.
+    template<std::invocable<double, double> F>
+        requires std::convertible_to<std::invoke_result_t<F&, double, double>, T>
+    GridFieldMapRZ(muc::array2d x0, muc::array2d x1, std::array<int, 2> n, F&& f);
+
+    auto X0() const -> const auto& { return fX0; }
+    auto X1() const -> const auto& { return fX1; }
+    auto N() const -> const auto& { return fN; }
+    auto Node() const -> const auto& { return fNode; }
+
+    auto operator()(double x, double y, double z) const -> T;
+
+private:
+    template<typename F>
+    static auto Sample(muc::array2d x0, muc::array2d x1, std::array<int, 2> n, F& f) -> std::vector<T>;
+
+    MUSTARD_ALWAYS_INLINE auto Interpolate(double r, double z) const -> T;
+
+private:
+    muc::array2d fX0;
+    muc::array2d fX1;
+    std::array<int, 2> fN;
+    muc::array2d fInverseSpacing;
+    std::vector<T> fNode;
+    [[no_unique_address]] AFieldTransform fFieldTransform;
+
+    static constexpr auto fgDimension{static_cast<int>(VectorDimension<T>)};
+};
+
+} // namespace Mustard::Detector::Field
+
+#include "Mustard/Detector/Field/GridFieldMapRZ.inl"
@@ -0,0 +1,112 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Detector::Field {
+
+template<Concept::MathVector<double> T, typename AFieldTransform>
+    requires(VectorDimension<T> == 3 or VectorDimension<T> == 6)
+GridFieldMapRZ<T, AFieldTransform>::GridFieldMapRZ(muc::array2d x0, muc::array2d x1, std::array<int, 2> n, std::vector<T> node) :
+    fX0{x0},
+    fX1{x1},
+    fN{n},
+    fInverseSpacing{},
+    fNode{std::move(node)},
+    fFieldTransform{} {
+    if (fX0[0] < 0) { throw std::invalid_argument{PrettyException("Field map grid requires r0 >= 0")}; }
+    for (int a{}; a < 2; ++a) {
+        if (fN[a] < 2) { throw std::invalid_argument{PrettyException("Field map grid requires at least 2 nodes per axis")}; }
+        if (not(fX0[a] < fX1[a])) { throw std::invalid_argument{PrettyException("Field map grid requires x0 < x1")}; }
+        fInverseSpacing[a] = (fN[a] - 1) / (fX1[a] - fX0[a]);
+    }
+    if (fNode.size() != static_cast<std::size_t>(fN[0]) * fN[1]) {
+        throw std::invalid_argument{PrettyException("Number of field map nodes does not match the grid")};
+    }
+    if (fX0[0] == 0) {
+        for (int k{}; k < fN[1]; ++k) {
+            for (int c{}; c < fgDimension; c += 3) {
+                fNode[k][c] = 0;
+                fNode[k][c + 1] = 0;
+            }
+        }
+    }
+}
+
+template<Concept::MathVector<double> T, typename AFieldTransform>
+    requires(VectorDimension<T> == 3 or VectorDimension<T> == 6)
+template<std::invocable<double, double> F>
+    requires std::convertible_to<std::invoke_result_t<F&, double, double>, T>
+GridFieldMapRZ<T, AFieldTransform>::GridFieldMapRZ(muc::array2d x0, muc::array2d x1, std::array<int, 2> n, F&& f) :
+    GridFieldMapRZ{x0, x1, n, Sample(x0, x1, n, f)} {}
+
+template<Concept::MathVector<double> T, typename AFieldTransform>
+    requires(VectorDimension<T> == 3 or VectorDimension<T> == 6)
+auto GridFieldMapRZ<T, AFieldTransform>::operator()(double x, double y, double z) const -> T {
+    const auto r{std::hypot(x, y)};
+    auto f{Interpolate(r, z)};
+    // rotate (r, phi) components to (x, y), transverse components are zero on the axis
+    const auto cosPhi{r > 0 ? x / r : 0.};
+    const auto sinPhi{r > 0 ? y / r : 0.};
+    for (int c{}; c < fgDimension; c += 3) {
+        const auto fR{f[c]};
+        const auto fPhi{f[c + 1]};
+        f[c] = fR * cosPhi - fPhi * sinPhi;
+        f[c + 1] = fR * sinPhi + fPhi * cosPhi;
+    }
+    return fFieldTransform(x, y, z, std::move(f));
+}
+
+template<Concept::MathVector<double> T, typename AFieldTransform>
+    requires(VectorDimension<T> == 3 or VectorDimension<T> == 6)
+template<typename F>
+auto GridFieldMapRZ<T, AFieldTransform>::Sample(muc::array2d x0, muc::array2d x1, std::array<int, 2> n, F& f) -> std::vector<T> {
+    if (std::ranges::any_of(n, [](auto ni) { return ni < 2; })) { return {}; } // rejected by the constructor
+    std::vector<T> node;
+    node.reserve(static_cast<std::size_t>(n[0]) * n[1]);
+    for (int i{}; i < n[0]; ++i) {
+        const auto r{x0[0] + (x1[0] - x0[0]) * i / (n[0] - 1)};
+        for (int k{}; k < n[1]; ++k) {
+            const auto z{x0[1] + (x1[1] - x0[1]) * k / (n[1] - 1)};
+            node.push_back(f(r, z));
+        }
+    }
+    return node;
+}
+
+template<Concept::MathVector<double> T, typename AFieldTransform>
+    requires(VectorDimension<T> == 3 or VectorDimension<T> == 6)
+MUSTARD_ALWAYS_INLINE auto GridFieldMapRZ<T, AFieldTransform>::Interpolate(double r, double z) const -> T {
+    const std::array<double, 2> xg{r, z};
+    std::array<int, 2> i;
+    std::array<double, 2> t;
+    for (int a{}; a < 2; ++a) {
+        t[a] = std::clamp((xg[a] - fX0[a]) * fInverseSpacing[a], 0., fN[a] - 1.);
+        i[a] = std::min(static_cast<int>(t[a]), fN[a] - 2);
+        t[a] -= i[a];
+    }
+    const auto node{fNode.data() + i[0] * fN[1] + i[1]};
+    const auto [u, w]{t};
+    T f;
+    for (int c{}; c < fgDimension; ++c) {
+        const auto f0{node[0][c] + w * (node[1][c] - node[0][c])};
+        const auto f1{node[fN[1]][c] + w * (node[fN[1] + 1][c] - node[fN[1]][c])};
+        f[c] = f0 + u * (f1 - f0);
+    }
+    return f;
+}
+
+} // namespace Mustard::Detector::Field
@@ -23,7 +23,9 @@
 #include "Mustard/Detector/Field/ElectromagneticFieldBase.h++"
 #include "Mustard/Detector/Field/MagneticField.h++"
 
+#include <algorithm>
 #include <concepts>
+#include <span>
 
 namespace Mustard::Detector::Field {
 
@@ -45,6 +47,11 @@ public:
     static constexpr auto E(T) -> T { return {0, 0, 0}; }
     template<Concept::NumericVector3D T>
     constexpr auto BE(T x) const -> F<T> { return {static_cast<const ADerived*>(this)->B(x), E(x)}; }
+
+    template<Concept::NumericVector3D T>
+    static auto BatchE(std::span<const T>, std::span<T> e) -> void { std::ranges::fill(e, T{0, 0, 0}); }
+    template<Concept::NumericVector3D T>
+    auto BatchBE(std::span<const T> x, std::span<T> b, std::span<T> e) const -> void;
 };
 
 } // namespace Mustard::Detector::Field
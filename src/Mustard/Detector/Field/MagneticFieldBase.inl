@@ -26,4 +26,11 @@ constexpr MagneticFieldBase<ADerived>::MagneticFieldBase() :
     static_assert(MagneticField<ADerived>);
 }
 
+template<typename ADerived>
+template<Concept::NumericVector3D T>
+auto MagneticFieldBase<ADerived>::BatchBE(std::span<const T> x, std::span<T> b, std::span<T> e) const -> void {
+    static_cast<const ADerived*>(this)->BatchB(x, b);
+    BatchE(x, e);
+}
+
 } // namespace Mustard::Detector::Field
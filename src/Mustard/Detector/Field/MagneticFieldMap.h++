@@ -21,7 +21,10 @@
 #include "Mustard/Concept/MathVector.h++"
 #include "Mustard/Concept/NumericVector.h++"
 #include "Mustard/Detector/Field/FieldMapSymmetry.h++"
+#include "Mustard/Detector/Field/GridFieldMapRZ.h++"
+#include "Mustard/Detector/Field/internal/BatchInterpolate.h++"
 #include "Mustard/Detector/Field/MagneticFieldBase.h++"
+#include "Mustard/Env/Trace.h++"
 #include "Mustard/Utility/InlineMacro.h++"
 #include "Mustard/Utility/VectorCast.h++"
 
@@ -33,6 +36,10 @@
 
 #include "muc/functional"
 
+#include <cassert>
+#include <cstddef>
+#include <span>
+
 namespace Mustard::Detector::Field {
 
 /// @brief A functional type converts B-field SI field value
@@ -58,7 +65,17 @@ public:
     using AFieldMap::AFieldMap;
 
     template<Concept::NumericVector3D T>
-    auto B(T x) const -> T { return VectorCast<T>((*this)(x[0], x[1], x[2])); }
+    auto B(T x) const -> T {
+        MUSTARD_TRACE_SCOPE("Detector::Field::MagneticFieldMap");
+        return VectorCast<T>((*this)(x[0], x[1], x[2]));
+    }
+
+    template<Concept::NumericVector3D T>
+    auto BatchB(std::span<const T> x, std::span<T> b) const -> void {
+        assert(b.size() == x.size());
+        MUSTARD_TRACE_SCOPE("Detector::Field::MagneticFieldMap::Batch");
+        internal::BatchInterpolate<AFieldMap>(*this, x, [&](std::size_t i, auto&& f) { b[i] = VectorCast<T>(f); });
+    }
 };
 
 /// @brief An YZ plane mirror symmetry magnetic field interpolated from data.
@@ -96,4 +113,8 @@ template<Concept::MathVector3D T = Eigen::Vector3d>
 using MagneticFieldMapSymmetryXYZ = MagneticFieldMap<
     EFM::FieldMap3D<T, double, CoordinateSymmetryXYZ, BFieldSI2CLHEP<FieldSymmetryXYZ>>>;
 
+/// @brief An axisymmetric magnetic field interpolated from (r, z) data, see `GridFieldMapRZ`.
+template<Concept::MathVector3D T = Eigen::Vector3d>
+using MagneticFieldMapRZ = MagneticFieldMap<GridFieldMapRZ<T, BFieldSI2CLHEP<>>>;
+
 } // namespace Mustard::Detector::Field
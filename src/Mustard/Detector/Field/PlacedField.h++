@@ -0,0 +1,94 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Concept/NumericVector.h++"
+#include "Mustard/Detector/Field/ElectricField.h++"
+#include "Mustard/Detector/Field/ElectromagneticField.h++"
+#include "Mustard/Detector/Field/ElectromagneticFieldBase.h++"
+#include "Mustard/Detector/Field/MagneticField.h++"
+#include "Mustard/Detector/Field/TimeDependentField.h++"
+#include "Mustard/Utility/VectorCast.h++"
+
+#include "Eigen/Core"
+#include "Eigen/Geometry"
+
+#include "muc/array"
+
+#include <concepts>
+#include <utility>
+
+namespace Mustard::Detector::Field {
+
+/// @brief A field placed by a rigid transformation: the point is transformed to the local frame
+/// of the field and the field vectors are rotated back. `Contains` is forwarded if the
+/// underlying field has one (e.g. a `BoundedField`, giving an oriented box).
+template<ElectromagneticField AField>
+class PlacedField : public ElectromagneticFieldBase<PlacedField<AField>> {
+private:
+    template<Concept::NumericVector3D T>
+    using F = typename ElectromagneticFieldBase<PlacedField<AField>>::template F<T>;
+
+public:
+    /// @brief Constructs the underlying field from args.
+    /// @param placement local-to-global transformation, e.g.
+    /// `Eigen::Translation3d{x0} * Eigen::AngleAxisd{angle, axis}`
+    template<typename... Args>
+        requires std::constructible_from<AField, Args&&...>
+    PlacedField(const Eigen::Transform<double, 3, Eigen::Isometry>& placement, Args&&... args);
+
+    auto Field() const -> const AField& { return fField; }
+
+    template<Concept::NumericVector3D T>
+        requires requires(const AField& field, muc::array3d x) { { field.Contains(x) } -> std::same_as<bool>; }
+    auto Contains(T x) const -> bool { return fField.Contains(ToLocal(x)); }
+
+    template<Concept::NumericVector3D T>
+        requires ElectricField<AField>
+    static constexpr auto B(T, double = 0) -> T { return {0, 0, 0}; }
+    template<Concept::NumericVector3D T>
+        requires(not ElectricField<AField>)
+    auto B(T x, double t = 0) const -> T;
+    template<Concept::NumericVector3D T>
+        requires MagneticField<AField>
+    static constexpr auto E(T, double = 0) -> T { return {0, 0, 0}; }
+    template<Concept::NumericVector3D T>
+        requires(not MagneticField<AField>)
+    auto E(T x, double t = 0) const -> T;
+    template<Concept::NumericVector3D T>
+    auto BE(T x, double t = 0) const -> F<T>;
+
+private:
+    template<Concept::NumericVector3D T>
+    auto ToLocal(T x) const -> muc::array3d;
+    template<Concept::NumericVector3D T>
+    auto ToGlobal(const muc::array3d& f) const -> T;
+
+private:
+    Eigen::Transform<double, 3, Eigen::Isometry> fToLocal;
+    Eigen::Matrix3d fRotation;
+    AField fField;
+};
+
+template<typename AField>
+PlacedField(const Eigen::Transform<double, 3, Eigen::Isometry>&, AField) -> PlacedField<AField>;
+
+} // namespace Mustard::Detector::Field
+
+#include "Mustard/Detector/Field/PlacedField.inl"
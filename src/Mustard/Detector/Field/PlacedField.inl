@@ -0,0 +1,63 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Detector::Field {
+
+template<ElectromagneticField AField>
+template<typename... Args>
+    requires std::constructible_from<AField, Args&&...>
+PlacedField<AField>::PlacedField(const Eigen::Transform<double, 3, Eigen::Isometry>& placement, Args&&... args) :
+    ElectromagneticFieldBase<PlacedField<AField>>{},
+    fToLocal{placement.inverse()},
+    fRotation{placement.linear()},
+    fField(std::forward<Args>(args)...) {}
+
+template<ElectromagneticField AField>
+template<Concept::NumericVector3D T>
+    requires(not ElectricField<AField>)
+auto PlacedField<AField>::B(T x, double t) const -> T {
+    return ToGlobal<T>(internal::BAt(fField, ToLocal(x), t));
+}
+
+template<ElectromagneticField AField>
+template<Concept::NumericVector3D T>
+    requires(not MagneticField<AField>)
+auto PlacedField<AField>::E(T x, double t) const -> T {
+    return ToGlobal<T>(internal::EAt(fField, ToLocal(x), t));
+}
+
+template<ElectromagneticField AField>
+template<Concept::NumericVector3D T>
+auto PlacedField<AField>::BE(T x, double t) const -> F<T> {
+    const auto [b, e]{internal::BEAt(fField, ToLocal(x), t)};
+    return {ToGlobal<T>(b), ToGlobal<T>(e)};
+}
+
+template<ElectromagneticField AField>
+template<Concept::NumericVector3D T>
+auto PlacedField<AField>::ToLocal(T x) const -> muc::array3d {
+    return VectorCast<muc::array3d>(Eigen::Vector3d{fToLocal * VectorCast<Eigen::Vector3d>(x)});
+}
+
+template<ElectromagneticField AField>
+template<Concept::NumericVector3D T>
+auto PlacedField<AField>::ToGlobal(const muc::array3d& f) const -> T {
+    return VectorCast<T>(Eigen::Vector3d{fRotation * VectorCast<Eigen::Vector3d>(f)});
+}
+
+} // namespace Mustard::Detector::Field
@@ -0,0 +1,47 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Detector/Field/TabulatedTimeProfile.h++"
+#include "Mustard/Utility/PrettyLog.h++"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace Mustard::Detector::Field {
+
+TabulatedTimeProfile::TabulatedTimeProfile(std::vector<double> time, std::vector<double> value) :
+    fTime{std::move(time)},
+    fValue{std::move(value)} {
+    if (fTime.size() < 2) { throw std::invalid_argument{PrettyException("Time profile requires at least 2 points")}; }
+    if (fTime.size() != fValue.size()) { throw std::invalid_argument{PrettyException("Time profile requires as many values as times")}; }
+    if (std::ranges::adjacent_find(fTime, std::greater_equal{}) != fTime.cend()) {
+        throw std::invalid_argument{PrettyException("Time profile requires strictly increasing times")};
+    }
+}
+
+auto TabulatedTimeProfile::operator()(double t) const -> double {
+    if (t <= fTime.front()) { return fValue.front(); }
+    if (t >= fTime.back()) { return fValue.back(); }
+    const auto i{static_cast<std::size_t>(std::ranges::upper_bound(fTime, t) - fTime.cbegin()) - 1};
+    return fValue[i] + (t - fTime[i]) / (fTime[i + 1] - fTime[i]) * (fValue[i + 1] - fValue[i]);
+}
+
+} // namespace Mustard::Detector::Field
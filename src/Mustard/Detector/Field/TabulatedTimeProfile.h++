@@ -0,0 +1,45 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <vector>
+
+namespace Mustard::Detector::Field {
+
+/// @brief A time profile f(t) linearly interpolated between tabulated points, e.g. a measured
+/// kicker pulse or magnet ramp, for `TimeModulatedField`. Before the first (after the last)
+/// point, the first (last) value is returned.
+class TabulatedTimeProfile {
+public:
+    /// @param time strictly increasing, at least 2 points
+    /// @param value f at each time
+    /// @exception Throw a std::invalid_argument if the table is invalid.
+    TabulatedTimeProfile(std::vector<double> time, std::vector<double> value);
+
+    auto Time() const -> const auto& { return fTime; }
+    auto Value() const -> const auto& { return fValue; }
+
+    auto operator()(double t) const -> double;
+
+private:
+    std::vector<double> fTime;
+    std::vector<double> fValue;
+};
+
+} // namespace Mustard::Detector::Field
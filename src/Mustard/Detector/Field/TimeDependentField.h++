@@ -0,0 +1,75 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Concept/NumericVector.h++"
+#include "Mustard/Detector/Field/ElectromagneticField.h++"
+#include "Mustard/Utility/InlineMacro.h++"
+
+#include "muc/array"
+
+#include <concepts>
+
+namespace Mustard::Detector::Field {
+
+/// @brief A field that also depends on time, evaluated by B(x, t), E(x, t) and BE(x, t).
+/// B(x), E(x) and BE(x) evaluate at t = 0.
+template<typename F>
+concept TimeDependentField =
+    requires(const F f, muc::array3d x, double t) {
+        requires ElectromagneticField<F>;
+        { f.B(x, t) } -> std::same_as<muc::array3d>;
+        { f.E(x, t) } -> std::same_as<muc::array3d>;
+        { f.BE(x, t).B } -> std::same_as<muc::array3d&&>;
+        { f.BE(x, t).E } -> std::same_as<muc::array3d&&>;
+    };
+
+namespace internal {
+
+/// @brief Evaluates any field at (x, t), a static field ignores t.
+template<ElectromagneticField AField, Concept::NumericVector3D T>
+MUSTARD_ALWAYS_INLINE auto BAt(const AField& field, T x, double t) -> T {
+    if constexpr (TimeDependentField<AField>) {
+        return field.B(x, t);
+    } else {
+        return field.B(x);
+    }
+}
+
+template<ElectromagneticField AField, Concept::NumericVector3D T>
+MUSTARD_ALWAYS_INLINE auto EAt(const AField& field, T x, double t) -> T {
+    if constexpr (TimeDependentField<AField>) {
+        return field.E(x, t);
+    } else {
+        return field.E(x);
+    }
+}
+
+template<ElectromagneticField AField, Concept::NumericVector3D T>
+MUSTARD_ALWAYS_INLINE auto BEAt(const AField& field, T x, double t) {
+    if constexpr (TimeDependentField<AField>) {
+        return field.BE(x, t);
+    } else {
+        return field.BE(x);
+    }
+}
+
+} // namespace internal
+
+} // namespace Mustard::Detector::Field
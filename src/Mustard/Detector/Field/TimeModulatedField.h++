@@ -0,0 +1,82 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Concept/NumericVector.h++"
+#include "Mustard/Detector/Field/ElectricField.h++"
+#include "Mustard/Detector/Field/ElectromagneticField.h++"
+#include "Mustard/Detector/Field/ElectromagneticFieldBase.h++"
+#include "Mustard/Detector/Field/MagneticField.h++"
+#include "Mustard/Detector/Field/TimeDependentField.h++"
+
+#include <concepts>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace Mustard::Detector::Field {
+
+/// @brief A field scaled by a time profile, f(t) * field(x, t), e.g. a pulsed kicker or a
+/// ramping magnet. Costs one evaluation of the underlying field and one of the profile.
+/// Remains a magnetic (electric) field if the underlying field is, so `AsG4Field` picks the
+/// same Geant4 field type, and passes the time of the track.
+/// @tparam AField underlying field, static or time dependent
+/// @tparam AProfile time profile, any callable f(t), e.g. a lambda or `TabulatedTimeProfile`
+template<ElectromagneticField AField, typename AProfile>
+    requires std::convertible_to<std::invoke_result_t<const AProfile&, double>, double>
+class TimeModulatedField : public ElectromagneticFieldBase<TimeModulatedField<AField, AProfile>> {
+private:
+    template<Concept::NumericVector3D T>
+    using F = typename ElectromagneticFieldBase<TimeModulatedField<AField, AProfile>>::template F<T>;
+
+public:
+    /// @brief Constructs the underlying field from args.
+    template<typename... Args>
+        requires std::constructible_from<AField, Args&&...>
+    TimeModulatedField(AProfile profile, Args&&... args);
+
+    auto Field() const -> const AField& { return fField; }
+    auto Profile() const -> const AProfile& { return fProfile; }
+
+    template<Concept::NumericVector3D T>
+        requires ElectricField<AField>
+    static constexpr auto B(T, double = 0) -> T { return {0, 0, 0}; }
+    template<Concept::NumericVector3D T>
+        requires(not ElectricField<AField>)
+    auto B(T x, double t = 0) const -> T;
+    template<Concept::NumericVector3D T>
+        requires MagneticField<AField>
+    static constexpr auto E(T, double = 0) -> T { return {0, 0, 0}; }
+    template<Concept::NumericVector3D T>
+        requires(not MagneticField<AField>)
+    auto E(T x, double t = 0) const -> T;
+    template<Concept::NumericVector3D T>
+    auto BE(T x, double t = 0) const -> F<T>;
+
+private:
+    AField fField;
+    [[no_unique_address]] AProfile fProfile;
+};
+
+template<typename AProfile, typename AField>
+TimeModulatedField(AProfile, AField) -> TimeModulatedField<AField, AProfile>;
+
+} // namespace Mustard::Detector::Field
+
+#include "Mustard/Detector/Field/TimeModulatedField.inl"
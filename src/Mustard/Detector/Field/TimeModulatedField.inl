@@ -0,0 +1,65 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Detector::Field {
+
+template<ElectromagneticField AField, typename AProfile>
+    requires std::convertible_to<std::invoke_result_t<const AProfile&, double>, double>
+template<typename... Args>
+    requires std::constructible_from<AField, Args&&...>
+TimeModulatedField<AField, AProfile>::TimeModulatedField(AProfile profile, Args&&... args) :
+    ElectromagneticFieldBase<TimeModulatedField<AField, AProfile>>{},
+    fField(std::forward<Args>(args)...),
+    fProfile{std::move(profile)} {}
+
+template<ElectromagneticField AField, typename AProfile>
+    requires std::convertible_to<std::invoke_result_t<const AProfile&, double>, double>
+template<Concept::NumericVector3D T>
+    requires(not ElectricField<AField>)
+auto TimeModulatedField<AField, AProfile>::B(T x, double t) const -> T {
+    const double f{std::invoke(fProfile, t)};
+    auto b{internal::BAt(fField, x, t)};
+    for (int i{}; i < 3; ++i) { b[i] *= f; }
+    return b;
+}
+
+template<ElectromagneticField AField, typename AProfile>
+    requires std::convertible_to<std::invoke_result_t<const AProfile&, double>, double>
+template<Concept::NumericVector3D T>
+    requires(not MagneticField<AField>)
+auto TimeModulatedField<AField, AProfile>::E(T x, double t) const -> T {
+    const double f{std::invoke(fProfile, t)};
+    auto e{internal::EAt(fField, x, t)};
+    for (int i{}; i < 3; ++i) { e[i] *= f; }
+    return e;
+}
+
+template<ElectromagneticField AField, typename AProfile>
+    requires std::convertible_to<std::invoke_result_t<const AProfile&, double>, double>
+template<Concept::NumericVector3D T>
+auto TimeModulatedField<AField, AProfile>::BE(T x, double t) const -> F<T> {
+    const double f{std::invoke(fProfile, t)};
+    auto [b, e]{internal::BEAt(fField, x, t)};
+    for (int i{}; i < 3; ++i) {
+        b[i] *= f;
+        e[i] *= f;
+    }
+    return {std::move(b), std::move(e)};
+}
+
+} // namespace Mustard::Detector::Field
@@ -22,6 +22,9 @@
 #include "Mustard/Concept/NumericVector.h++"
 #include "Mustard/Detector/Field/ElectricFieldBase.h++"
 
+#include <algorithm>
+#include <span>
+
 namespace Mustard::Detector::Field {
 
 class UniformElectricField : public ElectricFieldBase<UniformElectricField> {
@@ -32,6 +35,8 @@ public:
 
     template<Concept::NumericVector3D T>
     constexpr auto E(T) const -> T { return {fEx, fEy, fEz}; }
+    template<Concept::NumericVector3D T>
+    auto BatchE(std::span<const T>, std::span<T> e) const -> void { std::ranges::fill(e, T{fEx, fEy, fEz}); }
 
 private:
     double fEx;
@@ -24,6 +24,9 @@
 
 #include "muc/array"
 
+#include <algorithm>
+#include <span>
+
 namespace Mustard::Detector::Field {
 
 class UniformElectromagneticField : public ElectromagneticFieldBase<UniformElectromagneticField> {
@@ -40,6 +43,13 @@ public:
     template<Concept::NumericVector3D T>
     constexpr auto BE(T x) const -> F<T> { return {B(x), E(x)}; }
 
+    template<Concept::NumericVector3D T>
+    auto BatchB(std::span<const T>, std::span<T> b) const -> void { std::ranges::fill(b, T{fBx, fBy, fBz}); }
+    template<Concept::NumericVector3D T>
+    auto BatchE(std::span<const T>, std::span<T> e) const -> void { std::ranges::fill(e, T{fEx, fEy, fEz}); }
+    template<Concept::NumericVector3D T>
+    auto BatchBE(std::span<const T> x, std::span<T> b, std::span<T> e) const -> void { BatchB(x, b); BatchE(x, e); }
+
 private:
     double fBx;
     double fBy;
@@ -24,6 +24,9 @@
 
 #include "muc/array"
 
+#include <algorithm>
+#include <span>
+
 namespace Mustard::Detector::Field {
 
 class UniformMagneticField : public MagneticFieldBase<UniformMagneticField> {
@@ -34,6 +37,8 @@ public:
 
     template<Concept::NumericVector3D T>
     constexpr auto B(T) const -> T { return {fBx, fBy, fBz}; }
+    template<Concept::NumericVector3D T>
+    auto BatchB(std::span<const T>, std::span<T> b) const -> void { std::ranges::fill(b, T{fBx, fBy, fBz}); }
 
 private:
     double fBx;
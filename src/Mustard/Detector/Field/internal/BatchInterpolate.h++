@@ -0,0 +1,43 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Concept/NumericVector.h++"
+#include "Mustard/Utility/InlineMacro.h++"
+
+#include <cstddef>
+#include <span>
+#include <utility>
+
+namespace Mustard::Detector::Field::internal {
+
+/// @brief Calls Store(i, f) with the field map value f at each x[i], through the batched
+/// interpolation of AFieldMap if it has one (e.g. `GridFieldMap3D::Batch`), or point by point.
+template<typename AFieldMap, Concept::NumericVector3D T, typename S>
+MUSTARD_ALWAYS_INLINE auto BatchInterpolate(const AFieldMap& map, std::span<const T> x, S&& Store) -> void {
+    if constexpr (requires { map.Batch(x, Store); }) {
+        map.Batch(x, std::forward<S>(Store));
+    } else {
+        for (std::size_t i{}; i < x.size(); ++i) {
+            Store(i, map(x[i][0], x[i][1], x[i][2]));
+        }
+    }
+}
+
+} // namespace Mustard::Detector::Field::internal
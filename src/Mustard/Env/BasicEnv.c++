@@ -24,10 +24,12 @@
 #include "fmt/chrono.h"
 #include "fmt/color.h"
 
+#include <algorithm>
 #include <chrono>
 #include <filesystem>
 #include <system_error>
 #include <typeinfo>
+#include <utility>
 
 namespace Mustard::Env {
 
@@ -40,7 +42,10 @@ BasicEnv::BasicEnv(NoBanner, int argc, char* argv[],
     fShowBanner{showBannerHint},
     fArgc{argc},
     fArgv{argv},
-    fVerboseLevel{verboseLevel} {
+    fVerboseLevel{verboseLevel},
+    fAsyncLogger{},
+    fLogRedirector{},
+    fTracer{} {
     // CLI: do parse and get args
     if (cli) {
         const auto pCLI{&cli->get()};
@@ -49,6 +54,7 @@ BasicEnv::BasicEnv(NoBanner, int argc, char* argv[],
         if (basicCLI) {
             fVerboseLevel = basicCLI->VerboseLevel().value_or(verboseLevel);
             fShowBanner = basicCLI->ShowBanner();
+            AsyncLogging(basicCLI->AsyncLogging());
         }
     }
 }
@@ -58,6 +64,17 @@ BasicEnv::BasicEnv(int argc, char* argv[],
                    enum VerboseLevel verboseLevel,
                    bool showBannerHint) :
     BasicEnv{{}, argc, argv, cli, verboseLevel, showBannerHint} {
+    // MPIEnv does not get here, it redirects and traces each process to its own file
+    if (const auto basicCLI{cli ? dynamic_cast<const CLI::BasicModule*>(&cli->get()) : nullptr}) {
+        // Redirect output to the log file
+        if (basicCLI->LogFile()) {
+            RedirectLog(*basicCLI, *basicCLI->LogFile(), 0);
+        }
+        // Trace is exported on destruction
+        if (basicCLI->TraceFile()) {
+            StartTracing(*basicCLI->TraceFile(), 0);
+        }
+    }
     if (fShowBanner) {
         PrintStartBannerSplitLine();
         PrintStartBannerBody(argc, argv);
@@ -72,6 +89,29 @@ BasicEnv::~BasicEnv() {
     fShowBanner = false;
 }
 
+auto BasicEnv::AsyncLogging(bool a) -> void {
+    if (a == AsyncLogging()) { return; }
+    fAsyncLogger = a ? std::make_unique<internal::AsyncLogger>() : nullptr;
+}
+
+auto BasicEnv::RedirectLog(const CLI::BasicModule& cli, std::filesystem::path logFile, int rank) -> void {
+    const auto keepRank{cli.LogKeepRank()};
+    fLogRedirector = std::make_unique<internal::LogRedirector>(std::move(logFile),
+                                                               cli.LogMaxSize(),
+                                                               cli.LogMaxBackup(),
+                                                               not keepRank or std::ranges::count(*keepRank, rank));
+}
+
+auto BasicEnv::StartTracing([[maybe_unused]] std::filesystem::path traceFile, [[maybe_unused]] int rank) -> void {
+#if MUSTARD_TRACING
+    fTracer = std::make_unique<internal::Tracer>(std::move(traceFile), rank);
+#else
+    if (rank == 0) {
+        PrintWarning("Mustard is built without tracing (MUSTARD_TRACING=OFF), --trace is ignored\n");
+    }
+#endif
+}
+
 auto BasicEnv::PrintExitBanner() const -> void {
     using scsc = std::chrono::system_clock;
     Print(fmt::emphasis::bold,
@@ -21,16 +21,25 @@
 #include "Mustard/Env/CLI/CLI.h++"
 #include "Mustard/Env/Memory/PassiveSingleton.h++"
 #include "Mustard/Env/VerboseLevel.h++"
+#include "Mustard/Env/internal/AsyncLogger.h++"
 #include "Mustard/Env/internal/EnvBase.h++"
+#include "Mustard/Env/internal/LogRedirector.h++"
+#include "Mustard/Env/internal/Tracer.h++"
 #include "Mustard/Utility/InlineMacro.h++"
 
 #include "fmt/format.h"
 
+#include <filesystem>
 #include <functional>
+#include <memory>
 #include <optional>
 
 namespace Mustard::Env {
 
+namespace CLI::inline Module {
+class BasicModule;
+} // namespace CLI::inline Module
+
 class BasicEnv : public virtual internal::EnvBase,
                  public Memory::PassiveSingleton<BasicEnv> {
 protected:
@@ -58,7 +67,22 @@ public:
     MUSTARD_ALWAYS_INLINE auto VerboseLevelReach() const -> bool;
     auto VerboseLevel() const -> auto { return fVerboseLevel; }
 
+    /// Write messages of the Env::Print family (to C streams) asynchronously in a background thread.
+    /// Output to C++ streams is still synchronous, after pending messages are written.
+    /// Turning it off waits for other threads that are pushing messages, and is safe while they print.
+    auto AsyncLogging(bool a) -> void;
+    auto AsyncLogging() const -> bool { return fAsyncLogger != nullptr; }
+    /// Log file of this process if output is redirected (--log-file), otherwise nullptr.
+    auto LogFile() const -> const std::filesystem::path* { return fLogRedirector ? &fLogRedirector->File() : nullptr; }
+    /// Trace file of this process if tracing (--trace), otherwise nullptr.
+    auto TraceFile() const -> const std::filesystem::path* { return fTracer ? &fTracer->File() : nullptr; }
+
 protected:
+    /// Redirect output of this process to logFile, kept if rank is listed in --log-keep-rank (or if not given).
+    auto RedirectLog(const CLI::BasicModule& cli, std::filesystem::path logFile, int rank) -> void;
+    /// Record trace of this process, exported to traceFile on destruction. Warns if built without tracing.
+    auto StartTracing(std::filesystem::path traceFile, int rank) -> void;
+
     auto PrintStartBannerSplitLine() const -> void;
     auto PrintStartBannerBody(int argc, char* argv[]) const -> void;
     auto PrintExitBanner() const -> void;
@@ -70,6 +94,9 @@ private:
     int fArgc;
     char** fArgv;
     enum VerboseLevel fVerboseLevel;
+    std::unique_ptr<internal::AsyncLogger> fAsyncLogger;
+    std::unique_ptr<internal::LogRedirector> fLogRedirector;
+    std::unique_ptr<internal::Tracer> fTracer;
 };
 
 template<char L>
@@ -75,6 +75,40 @@ BasicModule::BasicModule(argparse::ArgumentParser& argParser) :
         .add_argument("-l", "--lite")
         .flag()
         .help("Do not show the Mustard banner.");
+    ArgParser()
+        .add_argument("--async-log")
+        .flag()
+        .help("Write log messages in a background thread, so that printing does not block the caller.");
+    ArgParser()
+        .add_argument("--log-file")
+        .help("Redirect stdout and stderr to a log file. In MPI programs each process writes to its own file "
+              "(e.g. 'run.log' becomes 'run/run_mpi<rank>.log', or 'run/<node>/run_mpi<rank>.log' on a cluster).");
+    ArgParser()
+        .add_argument("--log-max-size")
+        .help("Rotate the log file when it exceeds this size in MiB (unlimited by default).")
+        .scan<'g', double>();
+    ArgParser()
+        .add_argument("--log-max-backup")
+        .help("Number of rotated log files kept as <log file>.1, <log file>.2, ... (default: 1).")
+        .default_value(1)
+        .scan<'i', int>();
+    ArgParser()
+        .add_argument("--log-keep-rank")
+        .help("Keep log files of these MPI ranks (e.g. 0) and of ranks that reported errors. "
+              "Log files of other ranks are removed on normal exit. All log files are kept by default.")
+        .nargs(argparse::nargs_pattern::at_least_one)
+        .scan<'i', int>();
+    ArgParser()
+        .add_argument("--trace")
+        .help("Record traces of instrumented zones and export them as Chrome trace JSON (viewable in Perfetto). "
+              "In MPI programs each process writes to its own file (see --log-file). "
+              "Requires Mustard built with MUSTARD_TRACING.");
+}
+
+auto BasicModule::LogMaxSize() const -> std::uintmax_t {
+    const auto maxSize{ArgParser().present<double>("--log-max-size")};
+    if (not maxSize.has_value() or *maxSize <= 0) { return 0; }
+    return std::max<std::uintmax_t>(1, static_cast<std::uintmax_t>(*maxSize * 1024 * 1024));
 }
 
 auto BasicModule::VerboseLevel() const -> std::optional<enum VerboseLevel> {
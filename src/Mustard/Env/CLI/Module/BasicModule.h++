@@ -21,8 +21,10 @@
 #include "Mustard/Env/CLI/Module/ModuleBase.h++"
 #include "Mustard/Env/VerboseLevel.h++"
 
+#include <cstdint>
 #include <optional>
 #include <type_traits>
+#include <vector>
 
 namespace Mustard::Env::CLI::inline Module {
 
@@ -32,6 +34,13 @@ public:
 
     auto VerboseLevel() const -> std::optional<enum VerboseLevel>;
     auto ShowBanner() const -> auto { return not ArgParser().is_used("-l"); }
+    auto AsyncLogging() const -> auto { return ArgParser().is_used("--async-log"); }
+    auto LogFile() const -> auto { return ArgParser().present("--log-file"); }
+    /// In bytes, 0 means unlimited.
+    auto LogMaxSize() const -> std::uintmax_t;
+    auto LogMaxBackup() const -> auto { return ArgParser().get<int>("--log-max-backup"); }
+    auto LogKeepRank() const -> auto { return ArgParser().present<std::vector<int>>("--log-keep-rank"); }
+    auto TraceFile() const -> auto { return ArgParser().present("--trace"); }
 
 private:
     std::underlying_type_t<enum VerboseLevel> fVerboseLevelValue;
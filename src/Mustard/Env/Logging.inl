@@ -20,12 +20,14 @@ namespace Mustard::Env {
 
 template<typename... Ts>
 auto PrintPrettyInfo(std::string_view message, const std::source_location& location) -> void {
+    if (not VerboseLevelReach<'I'>()) { return; }
     PrintInfo(fg(fmt::color::deep_sky_blue), "{}", PrettyInfo(message, location));
     PrintInfo("\n");
 }
 
 template<typename... Ts>
 auto PrintPrettyWarning(std::string_view message, const std::source_location& location) -> void {
+    if (not VerboseLevelReach<'W'>()) { return; }
     const auto ts{fmt::emphasis::bold | fg(fmt::color::white) | bg(fmt::color::dark_orange)};
     PrintWarning(ts | fmt::emphasis::blink, "***");
     PrintWarning(ts, " {}", PrettyWarning(message, location));
@@ -34,6 +36,8 @@ auto PrintPrettyWarning(std::string_view message, const std::source_location& lo
 
 template<typename... Ts>
 auto PrintPrettyError(std::string_view message, const std::source_location& location) -> void {
+    internal::LogRedirector::ReportError();
+    if (not VerboseLevelReach<'E'>()) { return; }
     const auto ts{fmt::emphasis::bold | fg(fmt::color::white) | bg(fmt::color::red)};
     PrintError(ts | fmt::emphasis::blink, "***");
     PrintError(ts, " {}", PrettyError(message, location));
@@ -16,8 +16,10 @@
 // You should have received a copy of the GNU General Public License along with
 // Mustard. If not, see <https://www.gnu.org/licenses/>.
 
+#include "Mustard/Env/CLI/Module/BasicModule.h++"
 #include "Mustard/Env/MPIEnv.h++"
 #include "Mustard/Env/Print.h++"
+#include "Mustard/Extension/MPIX/ParallelizePath.h++"
 #include "Mustard/Utility/PrettyLog.h++"
 
 #include "TROOT.h"
@@ -27,10 +29,8 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdio>
-#include <cstring>
 #include <iomanip>
 #include <iterator>
-#include <map>
 #include <memory>
 #include <stdexcept>
 #include <thread>
@@ -70,131 +70,15 @@ MPIEnv::MPIEnv(NoBanner, int argc, char* argv[],
                           &size);         // size
             return size;
         }()},
-    fCluster{
-        [this] {
-            // Member fCluster to be initialized
-            std::remove_cv_t<decltype(fCluster)> cluster;
-            // Each process get its processor name
-            std::array<char, MPI_MAX_PROCESSOR_NAME> nodeNameSend;
-            int nameLength;
-            MPI_Get_processor_name(nodeNameSend.data(), // name
-                                   &nameLength);        // resultlen
-            // Master collects processor names
-            std::vector<std::array<char, MPI_MAX_PROCESSOR_NAME>> nodeNamesRecv;
-            if (OnCommWorldMaster()) { nodeNamesRecv.resize(fCommWorldSize); }
-            MPI_Request gatherNodeNamesRequest;
-            MPI_Igather(nodeNameSend.data(),      // sendbuf
-                        MPI_MAX_PROCESSOR_NAME,   // sendcount
-                        MPI_CHAR,                 // sendtype
-                        nodeNamesRecv.data(),     // recvbuf
-                        MPI_MAX_PROCESSOR_NAME,   // recvcount
-                        MPI_CHAR,                 // recvtype
-                        0,                        // root
-                        MPI_COMM_WORLD,           // comm
-                        &gatherNodeNamesRequest); // request
-            // Processor name list
-            std::vector<int> nodeIDSend;
-            int nodeIDRecv;
-            int nodeCount;
-            struct NodeInfoForMPI {
-                int size;
-                std::array<char, MPI_MAX_PROCESSOR_NAME> name;
-            };
-            MPI_Datatype structNodeInfoForMPI;
-            MPI_Type_create_struct(2,                                                      // count
-                                   std::array<int, 2>{1,                                   // array_of_block_lengths
-                                                      MPI_MAX_PROCESSOR_NAME}              // array_of_block_lengths
-                                       .data(),                                            // array_of_block_lengths
-                                   std::array<MPI_Aint, 2>{offsetof(NodeInfoForMPI, size), // array_of_displacements
-                                                           offsetof(NodeInfoForMPI, name)} // array_of_displacements
-                                       .data(),                                            // array_of_displacements
-                                   std::array<MPI_Datatype, 2>{MPI_INT,                    // array_of_types
-                                                               MPI_CHAR}                   // array_of_types
-                                       .data(),                                            // array_of_types
-                                   &structNodeInfoForMPI);                                 // newtype
-            MPI_Type_commit(&structNodeInfoForMPI);
-            MPI_Wait(&gatherNodeNamesRequest, // request
-                     MPI_STATUS_IGNORE);      // status
-            // Master find all unique processor names and assign node ID and count
-            std::vector<NodeInfoForMPI> nodeList;
-            if (OnCommWorldMaster()) {
-                // key: node name, mapped: rank
-                std::multimap<const std::array<char, MPI_MAX_PROCESSOR_NAME>&, int> nodeMap;
-                for (int rank{};
-                     auto&& name : std::as_const(nodeNamesRecv)) {
-                    nodeMap.emplace(name, rank++);
-                }
-
-                std::vector<std::pair<std::vector<int>, const std::array<char, MPI_MAX_PROCESSOR_NAME>*>> rankNode;
-                auto currentNodeName{&nodeMap.begin()->first};
-                rankNode.push_back({{}, currentNodeName});
-                for (auto&& [nodeName, rank] : std::as_const(nodeMap)) {
-                    if (std::strncmp(nodeName.data(), currentNodeName->data(), MPI_MAX_PROCESSOR_NAME)) {
-                        currentNodeName = &nodeName;
-                        rankNode.push_back({{}, currentNodeName});
-                    }
-                    rankNode.back().first.emplace_back(rank);
-                }
-                std::ranges::sort(rankNode);
-
-                nodeIDSend.resize(fCommWorldSize);
-                for (int nodeID{};
-                     auto&& [rankList, nodeName] : std::as_const(rankNode)) {
-                    nodeList.push_back({static_cast<int>(rankList.size()), *nodeName});
-                    for (auto&& rank : rankList) {
-                        nodeIDSend.at(rank) = nodeID;
-                    }
-                    ++nodeID;
-                }
-                nodeCount = ssize(rankNode);
-            }
-            // Scatter node ID
-            MPI_Request scatterNodeIDRequest;
-            MPI_Iscatter(nodeIDSend.data(),      // sendbuf
-                         1,                      // sendcount
-                         MPI_INT,                // sendtype
-                         &nodeIDRecv,            // recvbuf
-                         1,                      // recvcount
-                         MPI_INT,                // recvtype
-                         0,                      // root
-                         MPI_COMM_WORLD,         // comm
-                         &scatterNodeIDRequest); // request
-            // Broadcast node count
-            MPI_Bcast(&nodeCount,      // buffer
-                      1,               // count
-                      MPI_INT,         // datatype
-                      0,               // root
-                      MPI_COMM_WORLD); // comm
-            // Master send unique node name list
-            if (OnCommWorldWorker()) { nodeList.resize(nodeCount); }
-            MPI_Bcast(nodeList.data(),      // buffer
-                      nodeList.size(),      // count
-                      structNodeInfoForMPI, // datatype
-                      0,                    // root
-                      MPI_COMM_WORLD);      // comm
-            MPI_Type_free(&structNodeInfoForMPI);
-            // Assign to the list, convert node names to std::string
-            cluster.node.reserve(nodeCount);
-            for (auto&& [size, name] : std::as_const(nodeList)) {
-                cluster.node.push_back({size, name.data()});
-                cluster.node.back().name.shrink_to_fit();
-            }
-            cluster.node.shrink_to_fit();
-            // Assign local processor ID
-            MPI_Wait(&scatterNodeIDRequest, // request
-                     MPI_STATUS_IGNORE);    // status
-            cluster.local = nodeIDRecv;
-            // Return the cluster info
-            return cluster;
-        }()},
     fCommNode{
-        [this] {
+        [] {
             MPI_Comm comm;
-            // Constructs shared communicator
-            MPI_Comm_split(MPI_COMM_WORLD, // comm
-                           fCluster.local, // color
-                           0,              // key
-                           &comm);         // newcomm
+            // Constructs shared communicator, processes sharing memory are on the same node
+            MPI_Comm_split_type(MPI_COMM_WORLD,       // comm
+                                MPI_COMM_TYPE_SHARED, // split_type
+                                0,                    // key
+                                MPI_INFO_NULL,        // info
+                                &comm);               // newcomm
             return comm;
         }()},
     fCommNodeRank{
@@ -212,7 +96,87 @@ MPIEnv::MPIEnv(NoBanner, int argc, char* argv[],
             MPI_Comm_size(fCommNode, // comm
                           &size);    // size
             return size;
-        }()} {
+        }()},
+    fCommInterNode{
+        [this] {
+            MPI_Comm comm;
+            // Constructs communicator among node masters, ordered by world rank
+            MPI_Comm_split(MPI_COMM_WORLD,                         // comm
+                           OnCommNodeMaster() ? 0 : MPI_UNDEFINED, // color
+                           0,                                      // key
+                           &comm);                                 // newcomm
+            return comm;
+        }()},
+    fCluster{
+        [this] {
+            // Node ID is the rank of node master in the inter-node communicator
+            std::array<int, 2> cluster;
+            if (OnCommNodeMaster()) {
+                MPI_Comm_rank(fCommInterNode, // comm
+                              &cluster[0]);   // rank
+                MPI_Comm_size(fCommInterNode, // comm
+                              &cluster[1]);   // size
+            }
+            MPI_Bcast(cluster.data(), // buffer
+                      cluster.size(), // count
+                      MPI_INT,        // datatype
+                      0,              // root
+                      fCommNode);     // comm
+            return std::remove_cv_t<decltype(fCluster)>{cluster[0], cluster[1]};
+        }()},
+    fLocalNode{
+        [this] {
+            std::array<char, MPI_MAX_PROCESSOR_NAME> name;
+            int nameLength;
+            MPI_Get_processor_name(name.data(),  // name
+                                   &nameLength); // resultlen
+            return NodeInfo{fCommNodeSize, {name.data(), static_cast<std::size_t>(nameLength)}};
+        }()},
+    fNodeList{} {
+    // Node masters start exchanging node info, node list is built when first requested
+    fNodeList.request = MPI_REQUEST_NULL;
+    if (OnCommNodeMaster()) {
+        fNodeList.send.size = fLocalNode.size;
+        fNodeList.send.name.fill('\0');
+        std::ranges::copy(fLocalNode.name, fNodeList.send.name.begin());
+        fNodeList.recv.resize(ClusterSize());
+        MPI_Datatype structNodeInfoForMPI;
+        MPI_Type_create_struct(2,                                                      // count
+                               std::array<int, 2>{1,                                   // array_of_block_lengths
+                                                  MPI_MAX_PROCESSOR_NAME}              // array_of_block_lengths
+                                   .data(),                                            // array_of_block_lengths
+                               std::array<MPI_Aint, 2>{offsetof(NodeInfoForMPI, size), // array_of_displacements
+                                                       offsetof(NodeInfoForMPI, name)} // array_of_displacements
+                                   .data(),                                            // array_of_displacements
+                               std::array<MPI_Datatype, 2>{MPI_INT,                    // array_of_types
+                                                           MPI_CHAR}                   // array_of_types
+                                   .data(),                                            // array_of_types
+                               &structNodeInfoForMPI);                                 // newtype
+        MPI_Type_commit(&structNodeInfoForMPI);
+        MPI_Iallgather(&fNodeList.send,       // sendbuf
+                       1,                     // sendcount
+                       structNodeInfoForMPI,  // sendtype
+                       fNodeList.recv.data(), // recvbuf
+                       1,                     // recvcount
+                       structNodeInfoForMPI,  // recvtype
+                       fCommInterNode,        // comm
+                       &fNodeList.request);   // request
+        MPI_Type_free(&structNodeInfoForMPI);
+    }
+    if (const auto basicCLI{cli ? dynamic_cast<const CLI::BasicModule*>(&cli->get()) : nullptr}) {
+        // Redirect output of each process to its own log file
+        if (basicCLI->LogFile()) {
+            auto logFile{MPIX::ParallelizePath(*basicCLI->LogFile())};
+            if (OnCommWorldMaster()) {
+                PrintLn("Output of each MPI process is redirected to its own log file (rank 0: '{}')", logFile.generic_string());
+            }
+            RedirectLog(*basicCLI, std::move(logFile), fCommWorldRank);
+        }
+        // Trace of each process is exported to its own file on destruction
+        if (basicCLI->TraceFile()) {
+            StartTracing(MPIX::ParallelizePath(*basicCLI->TraceFile()), fCommWorldRank);
+        }
+    }
     // Disable ROOT implicit multi-threading
     if (ROOT::IsImplicitMTEnabled()) {
         ROOT::DisableImplicitMT();
@@ -232,7 +196,14 @@ MPIEnv::MPIEnv(int argc, char* argv[],
 }
 
 MPIEnv::~MPIEnv() {
-    // Destructs the local communicator
+    // Complete node info exchange if node list has never been requested
+    MPI_Wait(&fNodeList.request, // request
+             MPI_STATUS_IGNORE); // status
+    // Destructs the inter-node and local communicators
+    if (OnCommNodeMaster()) {
+        auto commInterNode{fCommInterNode};
+        MPI_Comm_free(&commInterNode);
+    }
     auto commNode{fCommNode};
     MPI_Comm_free(&commNode);
     // Wait all processes before finalizing
@@ -254,6 +225,24 @@ MPIEnv::~MPIEnv() {
     fShowBanner = false;
 }
 
+auto MPIEnv::LazyNodeList() const -> const std::vector<NodeInfo>& {
+    if (OnCommNodeWorker()) {
+        throw std::logic_error{PrettyException("Node list is only available on node master processes")};
+    }
+    std::call_once(fNodeList.built,
+                   [this] {
+                       MPI_Wait(&fNodeList.request, // request
+                                MPI_STATUS_IGNORE); // status
+                       fNodeList.node.reserve(fNodeList.recv.size());
+                       for (auto&& [size, name] : std::as_const(fNodeList.recv)) {
+                           fNodeList.node.push_back({size, name.data()});
+                           fNodeList.node.back().name.shrink_to_fit();
+                       }
+                       fNodeList.recv = {};
+                   });
+    return fNodeList.node;
+}
+
 auto MPIEnv::PrintStartBannerBody(int argc, char* argv[]) const -> void {
     BasicEnv::PrintStartBannerBody(argc, argv);
     // MPI library version
@@ -24,8 +24,10 @@
 
 #include "mpi.h"
 
+#include <array>
 #include <concepts>
 #include <functional>
+#include <mutex>
 #include <optional>
 #include <ostream>
 #include <string>
@@ -72,11 +74,12 @@ public:
     auto OnCommNodeMaster() const -> auto { return CommNodeRank() == 0; }
     auto OnCommNodeWorker() const -> auto { return CommNodeRank() != 0; }
 
-    auto NodeList() const -> const auto& { return fCluster.node; }
+    /// Only available on node masters (CommNodeRank() == 0). Built on first call.
+    auto NodeList() const -> const auto& { return LazyNodeList(); }
     auto LocalNodeID() const -> const auto& { return fCluster.local; }
     auto Node(int id) const -> const auto& { return NodeList().at(id); }
-    auto LocalNode() const -> const auto& { return Node(LocalNodeID()); }
-    auto ClusterSize() const -> int { return NodeList().size(); }
+    auto LocalNode() const -> const auto& { return fLocalNode; }
+    auto ClusterSize() const -> int { return fCluster.size; }
     auto OnSingleNode() const -> auto { return ClusterSize() == 1; }
     auto OnCluster() const -> auto { return ClusterSize() != 1; }
 
@@ -89,20 +92,38 @@ private:
         std::string name;
     };
 
+    struct NodeInfoForMPI {
+        int size;
+        std::array<char, MPI_MAX_PROCESSOR_NAME> name;
+    };
+
+private:
+    auto LazyNodeList() const -> const std::vector<NodeInfo>&;
+
 private:
     const int fMPIThreadSupport;
 
     const int fCommWorldRank;
     const int fCommWorldSize;
 
+    const MPI_Comm fCommNode;
+    const int fCommNodeRank;
+    const int fCommNodeSize;
+    const MPI_Comm fCommInterNode;
+
     const struct {
-        std::vector<NodeInfo> node;
         int local;
+        int size;
     } fCluster;
+    const NodeInfo fLocalNode;
 
-    const MPI_Comm fCommNode;
-    const int fCommNodeRank;
-    const int fCommNodeSize;
+    mutable struct {
+        NodeInfoForMPI send;
+        std::vector<NodeInfoForMPI> recv;
+        MPI_Request request;
+        std::once_flag built;
+        std::vector<NodeInfo> node;
+    } fNodeList;
 };
 
 } // namespace Mustard::Env
@@ -19,6 +19,8 @@
 #pragma once
 
 #include "Mustard/Env/BasicEnv.h++"
+#include "Mustard/Env/internal/AsyncLogger.h++"
+#include "Mustard/Env/internal/LogRedirector.h++"
 
 #include "fmt/color.h"
 #include "fmt/core.h"
@@ -26,6 +28,8 @@
 
 #include <cstdio>
 #include <ostream>
+#include <string>
+#include <utility>
 
 namespace Mustard::Env {
 
@@ -21,78 +21,113 @@ namespace Mustard::Env {
 template<char L, typename... Ts>
 auto Print(fmt::format_string<Ts...> fmt, Ts&&... args) -> void {
     if (not Env::VerboseLevelReach<L>()) { return; }
+    if (const auto logger{internal::AsyncLogger::Active()}) {
+        logger->Push(stdout, fmt::format(std::move(fmt), std::forward<Ts>(args)...));
+        return;
+    }
     fmt::print(std::move(fmt), std::forward<Ts>(args)...);
 }
 
 template<char L, typename... Ts>
 auto PrintLn(fmt::format_string<Ts...> fmt, Ts&&... args) -> void {
     if (not Env::VerboseLevelReach<L>()) { return; }
+    if (const auto logger{internal::AsyncLogger::Active()}) {
+        auto message{fmt::format(std::move(fmt), std::forward<Ts>(args)...)};
+        message.push_back('\n');
+        logger->Push(stdout, std::move(message));
+        return;
+    }
     fmt::println(std::move(fmt), std::forward<Ts>(args)...);
 }
 
 template<char L, typename... Ts>
 auto Print(const fmt::text_style& ts, fmt::format_string<Ts...> fmt, Ts&&... args) -> void {
     if (not Env::VerboseLevelReach<L>()) { return; }
+    if (const auto logger{internal::AsyncLogger::Active()}) {
+        logger->Push(stdout, fmt::format(ts, std::move(fmt), std::forward<Ts>(args)...));
+        return;
+    }
     fmt::print(ts, std::move(fmt), std::forward<Ts>(args)...);
 }
 
 template<char L, typename... Ts>
 auto Print(std::FILE* f, fmt::format_string<Ts...> fmt, Ts&&... args) -> void {
     if (not Env::VerboseLevelReach<L>()) { return; }
+    if (const auto logger{internal::AsyncLogger::Active()}) {
+        logger->Push(f, fmt::format(std::move(fmt), std::forward<Ts>(args)...));
+        return;
+    }
     fmt::print(f, std::move(fmt), std::forward<Ts>(args)...);
 }
 
 template<char L, typename... Ts>
 auto PrintLn(std::FILE* f, fmt::format_string<Ts...> fmt, Ts&&... args) -> void {
     if (not Env::VerboseLevelReach<L>()) { return; }
+    if (const auto logger{internal::AsyncLogger::Active()}) {
+        auto message{fmt::format(std::move(fmt), std::forward<Ts>(args)...)};
+        message.push_back('\n');
+        logger->Push(f, std::move(message));
+        return;
+    }
     fmt::println(f, std::move(fmt), std::forward<Ts>(args)...);
 }
 
 template<char L, typename... Ts>
 auto Print(std::FILE* f, const fmt::text_style& ts, fmt::format_string<Ts...> fmt, Ts&&... args) -> void {
     if (not Env::VerboseLevelReach<L>()) { return; }
+    if (const auto logger{internal::AsyncLogger::Active()}) {
+        logger->Push(f, fmt::format(ts, std::move(fmt), std::forward<Ts>(args)...));
+        return;
+    }
     fmt::print(f, ts, std::move(fmt), std::forward<Ts>(args)...);
 }
 
 template<char L, typename... Ts>
 auto Print(std::ostream& os, fmt::format_string<Ts...> fmt, Ts&&... args) -> void {
     if (not Env::VerboseLevelReach<L>()) { return; }
+    if (const auto logger{internal::AsyncLogger::Active()}) { logger->Flush(); }
     fmt::print(os, std::move(fmt), std::forward<Ts>(args)...);
 }
 
 template<char L, typename... Ts>
 auto PrintLn(std::ostream& os, fmt::format_string<Ts...> fmt, Ts&&... args) -> void {
     if (not Env::VerboseLevelReach<L>()) { return; }
+    if (const auto logger{internal::AsyncLogger::Active()}) { logger->Flush(); }
     fmt::println(os, std::move(fmt), std::forward<Ts>(args)...);
 }
 
 template<char L, typename... Ts>
 auto Print(std::ostream& os, const fmt::text_style& ts, fmt::format_string<Ts...> fmt, Ts&&... args) -> void {
     if (not Env::VerboseLevelReach<L>()) { return; }
+    if (const auto logger{internal::AsyncLogger::Active()}) { logger->Flush(); }
     fmt::print(os, ts, std::move(fmt), std::forward<Ts>(args)...);
 }
 
 template<char L, typename... Ts>
 auto Print(std::wostream& os, fmt::basic_format_string<wchar_t, fmt::type_identity_t<Ts>...> fmt, Ts&&... args) -> void {
     if (not Env::VerboseLevelReach<L>()) { return; }
+    if (const auto logger{internal::AsyncLogger::Active()}) { logger->Flush(); }
     fmt::print(os, std::move(fmt), std::forward<Ts>(args)...);
 }
 
 template<char L, typename... Ts>
 auto PrintLn(std::wostream& os, fmt::basic_format_string<wchar_t, fmt::type_identity_t<Ts>...> fmt, Ts&&... args) -> void {
     if (not Env::VerboseLevelReach<L>()) { return; }
+    if (const auto logger{internal::AsyncLogger::Active()}) { logger->Flush(); }
     fmt::println(os, std::move(fmt), std::forward<Ts>(args)...);
 }
 
 template<char L, typename... Ts>
 auto Print(std::wostream& os, const fmt::text_style& ts, fmt::basic_format_string<wchar_t, fmt::type_identity_t<Ts>...> fmt, Ts&&... args) -> void {
     if (not Env::VerboseLevelReach<L>()) { return; }
+    if (const auto logger{internal::AsyncLogger::Active()}) { logger->Flush(); }
     fmt::print(os, ts, std::move(fmt), std::forward<Ts>(args)...);
 }
 
 template<char L>
 auto VPrint(auto&&... args) -> void {
     if (not Env::VerboseLevelReach<L>()) { return; }
+    if (const auto logger{internal::AsyncLogger::Active()}) { logger->Flush(); }
     fmt::vprint(std::forward<decltype(args)>(args)...);
 }
 
@@ -138,21 +173,25 @@ auto VPrintWarning(auto&&... args) -> void {
 
 template<typename... Ts>
 auto PrintError(fmt::format_string<Ts...> fmt, Ts&&... args) -> void {
+    internal::LogRedirector::ReportError();
     Print<'E'>(stderr, std::move(fmt), std::forward<Ts>(args)...);
 }
 
 template<typename... Ts>
 auto PrintLnError(fmt::format_string<Ts...> fmt, Ts&&... args) -> void {
+    internal::LogRedirector::ReportError();
     PrintLn<'E'>(stderr, std::move(fmt), std::forward<Ts>(args)...);
 }
 
 template<typename... Ts>
 auto PrintError(const fmt::text_style& ts, fmt::format_string<Ts...> fmt, Ts&&... args) -> void {
+    internal::LogRedirector::ReportError();
     Print<'E'>(stderr, ts, std::move(fmt), std::forward<Ts>(args)...);
 }
 
 template<typename... Ts>
 auto VPrintError(auto&&... args) -> void {
+    internal::LogRedirector::ReportError();
     VPrint<'E'>(stderr, std::forward<decltype(args)>(args)...);
 }
 
@@ -0,0 +1,71 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Env/internal/Tracer.h++"
+#include "Mustard/Utility/InlineMacro.h++"
+
+#include <cstdint>
+#include <optional>
+
+namespace Mustard::Env {
+
+/// Records a zone from construction to destruction if tracing is active (--trace).
+/// Prefer MUSTARD_TRACE_SCOPE, which compiles to nothing if Mustard is built without tracing.
+class TraceScope {
+public:
+    /// name must be a string literal.
+    MUSTARD_ALWAYS_INLINE explicit TraceScope(const char* name, std::optional<std::int64_t> id = {}) :
+        fTracer{internal::Tracer::Active()},
+        fName{name},
+        fID{id},
+        fBegin{fTracer ? fTracer->Now() : 0} {}
+    MUSTARD_ALWAYS_INLINE ~TraceScope() {
+        if (fTracer) { fTracer->Zone(fName, fBegin, fID); }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    auto operator=(const TraceScope&) -> TraceScope& = delete;
+
+private:
+    internal::Tracer* fTracer;
+    const char* fName;
+    std::optional<std::int64_t> fID;
+    std::int64_t fBegin;
+};
+
+/// Records a counter value if tracing is active (--trace). name must be a string literal.
+/// Prefer MUSTARD_TRACE_COUNTER, which compiles to nothing if Mustard is built without tracing.
+MUSTARD_ALWAYS_INLINE auto TraceCounter(const char* name, double value) -> void {
+    if (const auto tracer{internal::Tracer::Active()}) { tracer->Counter(name, value); }
+}
+
+} // namespace Mustard::Env
+
+#define MUSTARD_TRACE_CONCAT_IMPL(a, b) a##b
+#define MUSTARD_TRACE_CONCAT(a, b) MUSTARD_TRACE_CONCAT_IMPL(a, b)
+
+#if MUSTARD_TRACING
+#    define MUSTARD_TRACE_SCOPE(...) \
+        const ::Mustard::Env::TraceScope MUSTARD_TRACE_CONCAT(mustardTraceScope, __LINE__) { __VA_ARGS__ }
+#    define MUSTARD_TRACE_COUNTER(name, value) ::Mustard::Env::TraceCounter(name, value)
+#else
+#    define MUSTARD_TRACE_SCOPE(...) static_cast<void>(0)
+#    define MUSTARD_TRACE_COUNTER(name, value) static_cast<void>(0)
+#endif
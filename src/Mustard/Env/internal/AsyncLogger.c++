@@ -0,0 +1,149 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Env/internal/AsyncLogger.h++"
+#include "Mustard/Utility/PrettyLog.h++"
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <stop_token>
+#include <utility>
+
+namespace Mustard::Env::internal {
+
+std::atomic<AsyncLogger*> AsyncLogger::fgActive{};
+std::atomic<unsigned> AsyncLogger::fgNLease{};
+
+AsyncLogger::Lease::Lease() :
+    NonMoveableBase{},
+    fLogger{} {
+    // count before loading, so that the destructor either sees the lease or is seen deactivated
+    fgNLease.fetch_add(1, std::memory_order::seq_cst);
+    fLogger = fgActive.load(std::memory_order::seq_cst);
+    if (fLogger == nullptr) { fgNLease.fetch_sub(1, std::memory_order::relaxed); }
+}
+std::atomic<unsigned> AsyncLogger::fgNInstance{};
+
+AsyncLogger::AsyncLogger() :
+    NonMoveableBase{},
+    fID{++fgNInstance},
+    fMutex{},
+    fRingList{},
+    fWrittenFile{},
+    fWriterThread{} {
+    if (AsyncLogger* expected{}; not fgActive.compare_exchange_strong(expected, this)) {
+        throw std::logic_error{PrettyException("Trying to activate asynchronous logging twice")};
+    }
+    // write out pending messages if the program exits without destructing the environment
+    if (static auto registered{false}; not registered) {
+        std::atexit([] { Detach(); });
+        registered = true;
+    }
+    fWriterThread = std::jthread{
+        [this](std::stop_token stop) {
+            while (not stop.stop_requested()) {
+                bool written;
+                {
+                    const std::scoped_lock lock{fMutex};
+                    written = Drain();
+                }
+                if (not written) { std::this_thread::sleep_for(fgPollingPeriod); }
+            }
+        }};
+}
+
+AsyncLogger::~AsyncLogger() {
+    auto self{this};
+    fgActive.compare_exchange_strong(self, nullptr, std::memory_order::seq_cst); // unless already detached
+    // wait for threads that got this logger before deactivation, leases taken afterwards get nullptr
+    while (fgNLease.load(std::memory_order::seq_cst) != 0) {
+        std::this_thread::yield();
+    }
+    fWriterThread.request_stop();
+    fWriterThread.join();
+    Flush();
+}
+
+auto AsyncLogger::Detach() -> void {
+    if (const auto logger{fgActive.exchange(nullptr)}) {
+        logger->Flush();
+    }
+}
+
+auto AsyncLogger::Push(std::FILE* file, std::string message) -> void {
+    auto& ring{LocalRing()};
+    const auto tail{ring.tail.load(std::memory_order::relaxed)};
+    // wait for the writer thread if the ring buffer is full
+    while (tail - ring.head.load(std::memory_order::acquire) == Ring::fgCapacity) {
+        std::this_thread::yield();
+    }
+    ring.slot[tail % Ring::fgCapacity] = {file, std::move(message)};
+    ring.tail.store(tail + 1, std::memory_order::release);
+}
+
+auto AsyncLogger::Flush() -> void {
+    // do not wait forever on crash, in case the writer thread has been stopped while writing
+    std::unique_lock lock{fMutex, std::defer_lock};
+    for (auto nTrial{fgFlushTimeout / fgPollingPeriod}; not lock.try_lock(); --nTrial) {
+        if (nTrial == 0) { return; }
+        std::this_thread::sleep_for(fgPollingPeriod);
+    }
+    while (Drain()) {}
+}
+
+auto AsyncLogger::LocalRing() -> Ring& {
+    thread_local struct {
+        unsigned owner;
+        std::shared_ptr<Ring> ring;
+    } local{};
+    if (local.owner != fID) [[unlikely]] {
+        local.ring = std::make_shared<Ring>();
+        local.owner = fID;
+        const std::scoped_lock lock{fMutex};
+        fRingList.push_back(local.ring);
+    }
+    return *local.ring;
+}
+
+auto AsyncLogger::Drain() -> bool {
+    auto written{false};
+    for (auto&& ring : fRingList) {
+        const auto tail{ring->tail.load(std::memory_order::acquire)};
+        auto head{ring->head.load(std::memory_order::relaxed)};
+        if (head == tail) { continue; }
+        for (; head != tail; ++head) {
+            auto& [file, message]{ring->slot[head % Ring::fgCapacity]};
+            std::fwrite(message.data(), 1, message.size(), file);
+            if (std::ranges::find(fWrittenFile, file) == fWrittenFile.cend()) { fWrittenFile.push_back(file); }
+            message = {};
+            ring->head.store(head + 1, std::memory_order::release);
+        }
+        written = true;
+    }
+    for (auto&& file : fWrittenFile) { std::fflush(file); }
+    fWrittenFile.clear();
+    // release ring buffers of exited threads
+    std::erase_if(fRingList, [](auto&& ring) {
+        return ring.use_count() == 1 and
+               ring->head.load(std::memory_order::relaxed) == ring->tail.load(std::memory_order::acquire);
+    });
+    return written;
+}
+
+} // namespace Mustard::Env::internal
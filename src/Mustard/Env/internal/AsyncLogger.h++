@@ -0,0 +1,106 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Utility/NonMoveableBase.h++"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Mustard::Env::internal {
+
+/// Asynchronous backend of the Env::Print family. Each thread pushes preformatted messages
+/// to its own lock-free single-producer ring buffer, and a background thread drains all
+/// ring buffers and writes messages in per-thread order. A producer waits only when its
+/// ring buffer is full.
+class AsyncLogger final : public NonMoveableBase {
+public:
+    /// Access to the logger in use. The logger is not destructed while a lease of it exists,
+    /// so that logging may be turned off while other threads are printing.
+    class Lease final : public NonMoveableBase {
+    public:
+        Lease();
+        ~Lease() {
+            if (fLogger) { fgNLease.fetch_sub(1, std::memory_order::release); }
+        }
+
+        explicit operator bool() const { return fLogger != nullptr; }
+        auto operator->() const -> AsyncLogger* { return fLogger; }
+
+    private:
+        AsyncLogger* fLogger;
+    };
+
+public:
+    AsyncLogger();
+    /// Waits for leases taken before deactivation to be released.
+    ~AsyncLogger();
+
+    /// The logger in use (false if logging is synchronous). Keep the lease only while pushing.
+    static auto Active() -> Lease { return {}; }
+    /// Switch to synchronous logging and write all pending messages. Used on crash and exit.
+    static auto Detach() -> void;
+
+    auto Push(std::FILE* file, std::string message) -> void;
+    /// Write all pending messages, from any thread.
+    auto Flush() -> void;
+
+private:
+    struct Entry {
+        std::FILE* file;
+        std::string message;
+    };
+
+    struct Ring {
+        static constexpr std::size_t fgCapacity{1024};
+
+        std::array<Entry, fgCapacity> slot;
+        alignas(64) std::atomic<std::size_t> head; // next to be written out
+        alignas(64) std::atomic<std::size_t> tail; // next to be pushed
+    };
+
+private:
+    auto LocalRing() -> Ring&;
+    /// Requires fMutex held.
+    auto Drain() -> bool;
+
+private:
+    unsigned fID;
+    std::mutex fMutex;
+    std::vector<std::shared_ptr<Ring>> fRingList;
+    std::vector<std::FILE*> fWrittenFile;
+    std::jthread fWriterThread;
+
+    static constexpr std::chrono::milliseconds fgPollingPeriod{1};
+    static constexpr std::chrono::milliseconds fgFlushTimeout{100};
+
+    static std::atomic<AsyncLogger*> fgActive;
+    static std::atomic<unsigned> fgNLease;
+    static std::atomic<unsigned> fgNInstance;
+};
+
+} // namespace Mustard::Env::internal
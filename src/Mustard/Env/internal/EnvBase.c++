@@ -19,6 +19,7 @@
 #include "Mustard/Env/Memory/internal/SingletonDeleter.h++"
 #include "Mustard/Env/Memory/internal/SingletonPool.h++"
 #include "Mustard/Env/Memory/internal/WeakSingletonPool.h++"
+#include "Mustard/Env/internal/AsyncLogger.h++"
 #include "Mustard/Env/internal/EnvBase.h++"
 #include "Mustard/Utility/PrettyLog.h++"
 
@@ -67,6 +68,8 @@ namespace {
                 return name;
             }
         }};
+    // write out pending messages, then print synchronously
+    AsyncLogger::Detach();
     try {
         const auto exception{std::current_exception()};
         if (exception) {
@@ -113,6 +116,7 @@ auto MUSTARD_SIGINT_SIGTERM_Handler(int sig) -> void {
     }
     static struct Handler {
         MUSTARD_ALWAYS_INLINE Handler(int sig) {
+            AsyncLogger::Detach();
             const auto now{std::chrono::system_clock::to_time_t(std::chrono::system_clock::now())};
             const auto lineHeader{MPIEnv::Available() ?
                                       fmt::format("MPI{}> ", MPIEnv::Instance().CommWorldRank()) :
@@ -143,6 +147,7 @@ auto MUSTARD_SIGINT_SIGTERM_Handler(int sig) -> void {
                 break;
             }
             PrintError("\n");
+            std::fflush(stdout);
             std::fflush(stderr);
             std::raise(sig);
         }
@@ -151,6 +156,7 @@ auto MUSTARD_SIGINT_SIGTERM_Handler(int sig) -> void {
 
 [[noreturn]] auto MUSTARD_SIGABRT_Handler(int) -> void {
     std::signal(SIGABRT, SIG_DFL);
+    AsyncLogger::Detach();
     const auto now{std::chrono::system_clock::to_time_t(std::chrono::system_clock::now())};
     const auto lineHeader{MPIEnv::Available() ?
                               fmt::format("MPI{}> ", MPIEnv::Instance().CommWorldRank()) :
@@ -167,6 +173,7 @@ auto MUSTARD_SIGINT_SIGTERM_Handler(int sig) -> void {
     PrintError("\n");
     PrintError(ts, "It is likely that an exception has been thrown. View the logs just before receiving SIGABRT for more information.\n");
     PrintError("\n");
+    std::fflush(stdout);
     std::fflush(stderr);
     std::abort();
 }
@@ -181,6 +188,7 @@ auto MUSTARD_SIGFPE_SIGILL_SIGSEGV_Handler(int sig) -> void {
     }
     static struct Handler {
         MUSTARD_ALWAYS_INLINE Handler(int sig) {
+            AsyncLogger::Detach();
             const auto now{std::chrono::system_clock::to_time_t(std::chrono::system_clock::now())};
             const auto lineHeader{MPIEnv::Available() ?
                                       fmt::format("MPI{}> ", MPIEnv::Instance().CommWorldRank()) :
@@ -207,6 +215,7 @@ auto MUSTARD_SIGFPE_SIGILL_SIGSEGV_Handler(int sig) -> void {
             PrintError("\n");
             PrintError(ts, "It is likely that the program has one or more errors. Try using debugging tools to address this issue.\n");
             PrintError("\n");
+            std::fflush(stdout);
             std::fflush(stderr);
             std::raise(sig);
         }
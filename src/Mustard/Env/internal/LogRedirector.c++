@@ -0,0 +1,113 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Env/internal/AsyncLogger.h++"
+#include "Mustard/Env/internal/LogRedirector.h++"
+#include "Mustard/Utility/PrettyLog.h++"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <stdexcept>
+#include <stop_token>
+#include <system_error>
+#include <utility>
+
+namespace Mustard::Env::internal {
+
+std::atomic<bool> LogRedirector::fgErrorReported{};
+
+LogRedirector::LogRedirector(std::filesystem::path file, std::uintmax_t maxSize, int nBackup, bool keep) :
+    NonMoveableBase{},
+    fFile{std::move(file)},
+    fMaxSize{maxSize},
+    fNBackup{std::max(0, nBackup)},
+    fKeep{keep},
+    fMonitorThread{} {
+    if (fFile.has_parent_path()) {
+        std::filesystem::create_directories(fFile.parent_path());
+    }
+    // check before touching stdout and stderr, they are lost if freopen fails
+    if (const auto test{std::fopen(fFile.c_str(), "w")}) {
+        std::fclose(test);
+    } else {
+        throw std::runtime_error{PrettyException(fmt::format("Cannot open log file '{}'", fFile.generic_string()))};
+    }
+    if (const auto logger{AsyncLogger::Active()}) { logger->Flush(); }
+    if (not Open()) {
+        throw std::runtime_error{PrettyException(fmt::format("Cannot redirect output to '{}'", fFile.generic_string()))};
+    }
+    if (fMaxSize == 0) { return; }
+    fMonitorThread = std::jthread{
+        [this](std::stop_token stop) {
+            std::mutex mutex;
+            std::condition_variable_any wakeUp;
+            std::unique_lock lock{mutex};
+            while (not stop.stop_requested()) {
+                wakeUp.wait_for(lock, stop, fgMonitorPeriod, [] { return false; });
+                std::error_code ec;
+                if (const auto size{std::filesystem::file_size(fFile, ec)};
+                    not ec and size > fMaxSize) {
+                    Rotate();
+                }
+            }
+        }};
+}
+
+LogRedirector::~LogRedirector() {
+    fMonitorThread = {};
+    if (const auto logger{AsyncLogger::Active()}) { logger->Flush(); }
+    std::fflush(stdout);
+    std::fflush(stderr);
+    if (fKeep or fgErrorReported.load(std::memory_order::relaxed)) { return; }
+    // stdout and stderr still refer to the removed file, so later output is discarded
+    std::error_code ec;
+    std::filesystem::remove(fFile, ec);
+    for (int i{1}; i <= fNBackup; ++i) {
+        std::filesystem::remove(Backup(i), ec);
+    }
+}
+
+auto LogRedirector::Open() const -> bool {
+    // both in append mode, so that writes from stdout and stderr do not overwrite each other
+    return std::freopen(fFile.c_str(), "a", stdout) and
+           std::freopen(fFile.c_str(), "a", stderr);
+}
+
+auto LogRedirector::Rotate() const -> void {
+    // best effort, never fail on logging
+    std::error_code ec;
+    if (fNBackup == 0) {
+        std::filesystem::remove(fFile, ec);
+    } else {
+        for (auto i{fNBackup - 1}; i >= 1; --i) {
+            std::filesystem::rename(Backup(i), Backup(i + 1), ec);
+        }
+        std::filesystem::rename(fFile, Backup(1), ec);
+    }
+    Open();
+}
+
+auto LogRedirector::Backup(int i) const -> std::filesystem::path {
+    return std::filesystem::path{fFile}.concat(fmt::format(".{}", i));
+}
+
+} // namespace Mustard::Env::internal
@@ -0,0 +1,63 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Utility/NonMoveableBase.h++"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <thread>
+
+namespace Mustard::Env::internal {
+
+/// Redirects stdout and stderr of this process to a log file. If the log file grows beyond
+/// the size limit, it is rotated to <file>.1, <file>.2, ..., keeping a limited number of them.
+/// If not to be kept, the log file and its backups are removed on destruction unless an error
+/// has been reported (abnormal termination never removes them).
+class LogRedirector final : public NonMoveableBase {
+public:
+    /// maxSize == 0 means unlimited.
+    LogRedirector(std::filesystem::path file, std::uintmax_t maxSize, int nBackup, bool keep);
+    ~LogRedirector();
+
+    auto File() const -> const auto& { return fFile; }
+
+    /// Called by the PrintError family.
+    static auto ReportError() -> void { fgErrorReported.store(true, std::memory_order::relaxed); }
+
+private:
+    auto Open() const -> bool;
+    auto Rotate() const -> void;
+    auto Backup(int i) const -> std::filesystem::path;
+
+private:
+    std::filesystem::path fFile;
+    std::uintmax_t fMaxSize;
+    int fNBackup;
+    bool fKeep;
+    std::jthread fMonitorThread;
+
+    static constexpr std::chrono::milliseconds fgMonitorPeriod{500};
+
+    static std::atomic<bool> fgErrorReported;
+};
+
+} // namespace Mustard::Env::internal
@@ -0,0 +1,130 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Env/Print.h++"
+#include "Mustard/Env/internal/Tracer.h++"
+#include "Mustard/Utility/PrettyLog.h++"
+
+#include "fmt/format.h"
+
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace Mustard::Env::internal {
+
+std::atomic<Tracer*> Tracer::fgActive{};
+std::atomic<unsigned> Tracer::fgNInstance{};
+
+Tracer::Tracer(std::filesystem::path file, int processID) :
+    NonMoveableBase{},
+    fID{++fgNInstance},
+    fFile{std::move(file)},
+    fProcessID{processID},
+    fStartTime{std::chrono::steady_clock::now()},
+    fMutex{},
+    fBufferList{} {
+    if (Tracer* expected{}; not fgActive.compare_exchange_strong(expected, this)) {
+        throw std::logic_error{PrettyException("Trying to activate tracing twice")};
+    }
+}
+
+Tracer::~Tracer() {
+    fgActive.store(nullptr, std::memory_order::release);
+    try {
+        Export();
+    } catch (const std::exception& e) {
+        PrintWarning("Failed to write trace to '{}' ({})\n", fFile.generic_string(), e.what());
+    }
+}
+
+auto Tracer::Zone(const char* name, std::int64_t begin, std::optional<std::int64_t> id) -> void {
+    const auto end{Now()};
+    Record({name, id ? EventType::ZoneWithID : EventType::Zone, begin, end - begin, id.value_or(0), {}});
+}
+
+auto Tracer::Counter(const char* name, double value) -> void {
+    Record({name, EventType::Counter, Now(), {}, {}, value});
+}
+
+auto Tracer::Record(const Event& event) -> void {
+    auto& buffer{LocalBuffer()};
+    if (buffer.event.size() == fgMaxNEventPerThread) [[unlikely]] {
+        ++buffer.nDropped;
+        return;
+    }
+    buffer.event.push_back(event);
+}
+
+auto Tracer::LocalBuffer() -> Buffer& {
+    thread_local struct {
+        unsigned owner;
+        std::shared_ptr<Buffer> buffer;
+    } local{};
+    if (local.owner != fID) [[unlikely]] {
+        local.buffer = std::make_shared<Buffer>();
+        local.owner = fID;
+        const std::scoped_lock lock{fMutex};
+        local.buffer->thread = fBufferList.size();
+        fBufferList.push_back(local.buffer);
+    }
+    return *local.buffer;
+}
+
+auto Tracer::Export() const -> void {
+    const std::unique_ptr<std::FILE, decltype([](std::FILE* f) { std::fclose(f); })> file{std::fopen(fFile.c_str(), "w")};
+    if (file == nullptr) {
+        throw std::runtime_error{PrettyException(fmt::format("Cannot open '{}'", fFile.generic_string()))};
+    }
+    const auto f{file.get()};
+    // timestamps are in microseconds
+    fmt::print(f, "{{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+                  "{{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":{0},\"args\":{{\"name\":\"Process {0}\"}}}}",
+               fProcessID);
+    std::size_t nDropped{};
+    for (auto&& buffer : fBufferList) {
+        fmt::print(f, ",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":{},\"tid\":{},\"args\":{{\"name\":\"Thread {}\"}}}}",
+                   fProcessID, buffer->thread, buffer->thread);
+        for (auto&& [name, type, time, duration, id, value] : buffer->event) {
+            const std::string_view nameView{name};
+            switch (type) {
+            case EventType::Zone:
+                fmt::print(f, ",\n{{\"name\":{:?},\"ph\":\"X\",\"pid\":{},\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                           nameView, fProcessID, buffer->thread, time / 1e3, duration / 1e3);
+                break;
+            case EventType::ZoneWithID:
+                fmt::print(f, ",\n{{\"name\":{:?},\"ph\":\"X\",\"pid\":{},\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f},\"args\":{{\"id\":{}}}}}",
+                           nameView, fProcessID, buffer->thread, time / 1e3, duration / 1e3, id);
+                break;
+            case EventType::Counter:
+                fmt::print(f, ",\n{{\"name\":{:?},\"ph\":\"C\",\"pid\":{},\"tid\":{},\"ts\":{:.3f},\"args\":{{\"value\":{}}}}}",
+                           nameView, fProcessID, buffer->thread, time / 1e3, value);
+                break;
+            }
+        }
+        nDropped += buffer->nDropped;
+    }
+    fmt::print(f, "\n]}}\n");
+    if (nDropped > 0) {
+        PrintWarning("{} trace events dropped in '{}' (limit: {} per thread)\n", nDropped, fFile.generic_string(), fgMaxNEventPerThread);
+    }
+}
+
+} // namespace Mustard::Env::internal
@@ -0,0 +1,97 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Utility/NonMoveableBase.h++"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace Mustard::Env::internal {
+
+/// Backend of Env tracing. Each thread records events to its own buffer without locking.
+/// Events are exported as Chrome trace JSON (viewable in Perfetto or chrome://tracing) on
+/// destruction, when recording threads are expected to have finished.
+class Tracer final : public NonMoveableBase {
+public:
+    /// Events of this process are shown under the process ID (e.g. MPI rank).
+    Tracer(std::filesystem::path file, int processID);
+    ~Tracer();
+
+    /// The tracer in use, or nullptr if tracing is disabled.
+    static auto Active() -> Tracer* { return fgActive.load(std::memory_order::acquire); }
+
+    auto File() const -> const auto& { return fFile; }
+
+    /// Nanoseconds since construction.
+    auto Now() const -> std::int64_t { return std::chrono::nanoseconds{std::chrono::steady_clock::now() - fStartTime}.count(); }
+    /// name must outlive the tracer (e.g. a string literal).
+    auto Zone(const char* name, std::int64_t begin, std::optional<std::int64_t> id = {}) -> void;
+    /// name must outlive the tracer (e.g. a string literal).
+    auto Counter(const char* name, double value) -> void;
+
+private:
+    enum struct EventType {
+        Zone,
+        ZoneWithID,
+        Counter
+    };
+
+    struct Event {
+        const char* name;
+        EventType type;
+        std::int64_t time;
+        std::int64_t duration;
+        std::int64_t id;
+        double value;
+    };
+
+    struct Buffer {
+        int thread;
+        std::size_t nDropped;
+        std::vector<Event> event;
+    };
+
+private:
+    auto Record(const Event& event) -> void;
+    auto LocalBuffer() -> Buffer&;
+    auto Export() const -> void;
+
+private:
+    unsigned fID;
+    std::filesystem::path fFile;
+    int fProcessID;
+    std::chrono::steady_clock::time_point fStartTime;
+    std::mutex fMutex;
+    std::vector<std::shared_ptr<Buffer>> fBufferList;
+
+    static constexpr std::size_t fgMaxNEventPerThread{1 << 21};
+
+    static std::atomic<Tracer*> fgActive;
+    static std::atomic<unsigned> fgNInstance;
+};
+
+} // namespace Mustard::Env::internal
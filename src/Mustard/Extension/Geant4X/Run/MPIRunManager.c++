@@ -17,6 +17,7 @@
 // Mustard. If not, see <https://www.gnu.org/licenses/>.
 
 #include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Env/Trace.h++"
 #include "Mustard/Extension/Geant4X/Run/MPIRunManager.h++"
 #include "Mustard/Utility/MPIReseedRandomEngine.h++"
 #include "Mustard/Utility/PrettyLog.h++"
@@ -111,6 +112,7 @@ auto MPIRunManager::ConfirmBeamOnCondition() -> G4bool {
 }
 
 auto MPIRunManager::DoEventLoop(G4int nEvent, const char* macroFile, G4int nSelect) -> void {
+    MUSTARD_TRACE_SCOPE("Geant4X::MPIRunManager::DoEventLoop");
     InitializeEventLoop(nEvent, macroFile, nSelect);
     // Set name for message
     if (currentRun) { fExecutor.ExecutionName(fmt::format("G4Run {}", currentRun->GetRunID())); }
@@ -30,7 +30,9 @@
 #include "gsl/gsl"
 
 #include <chrono>
+#include <filesystem>
 #include <memory>
+#include <utility>
 
 namespace Mustard::inline Extension::Geant4X::inline Run {
 
@@ -59,6 +61,15 @@ public:
 
     auto PrintProgress(G4bool b) -> void { fExecutor.PrintProgress(b), printModulo = -1; }
     auto PrintProgressModulo(G4int mod) -> void { fExecutor.PrintProgressModulo(mod), printModulo = -1; }
+    auto AsyncProgressReport(G4bool b) -> void { fExecutor.AsyncProgressReport(b); }
+    auto ChunkPolicy(MPIX::ChunkSizePolicy policy) -> void { fExecutor.ChunkPolicy(policy); }
+    auto Checkpoint(std::filesystem::path path) -> void { fExecutor.Checkpoint(std::move(path)); }
+    auto CheckpointPeriod(std::chrono::seconds t) -> void { fExecutor.CheckpointPeriod(t); }
+    auto Resume(std::filesystem::path path) -> void { fExecutor.Resume(std::move(path)); }
+    auto Metrics(std::filesystem::path path, MPIX::MetricsFormat format) -> void { fExecutor.Metrics(std::move(path), format); }
+    auto MetricsPeriod(std::chrono::seconds t) -> void { fExecutor.MetricsPeriod(t); }
+    auto ProfileEventTime(G4bool b) -> void { fExecutor.ProfileTaskTime(b); }
+    auto NSlowestEvent(G4int n) -> void { fExecutor.NSlowestTask(n); }
 
     virtual auto BeamOn(G4int nEvent, gsl::czstring macroFile = nullptr, G4int nSelect = -1) -> void override;
     virtual auto ConfirmBeamOnCondition() -> G4bool override;
@@ -20,10 +20,15 @@
 #include "Mustard/Extension/Geant4X/Run/MPIRunMessenger.h++"
 
 #include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAString.hh"
 #include "G4UIcmdWithAnInteger.hh"
 #include "G4UIcommand.hh"
 #include "G4UIdirectory.hh"
 
+#include <chrono>
+#include <filesystem>
+#include <string>
+
 namespace Mustard::inline Extension::Geant4X::inline Run {
 
 MPIRunMessenger::MPIRunMessenger() :
@@ -31,6 +36,15 @@ MPIRunMessenger::MPIRunMessenger() :
     fDirectory{},
     fPrintProgress{},
     fPrintProgressModulo{},
+    fAsyncProgressReport{},
+    fChunkPolicy{},
+    fCheckpoint{},
+    fCheckpointPeriod{},
+    fResume{},
+    fMetrics{},
+    fMetricsPeriod{},
+    fProfileEventTime{},
+    fNSlowestEvent{},
     fPrintRunSummary{} {
 
     fDirectory = std::make_unique<G4UIdirectory>("/Mustard/Run/");
@@ -46,6 +60,57 @@ MPIRunMessenger::MPIRunMessenger() :
     fPrintProgressModulo->SetParameterName("modulo", false);
     fPrintProgressModulo->AvailableForStates(G4State_PreInit, G4State_Idle);
 
+    fAsyncProgressReport = std::make_unique<G4UIcmdWithABool>("/Mustard/Run/AsyncProgressReport", this);
+    fAsyncProgressReport->SetGuidance("Set whether adaptive progress display is done by a background thread. Global progress is then extrapolated from local progress.");
+    fAsyncProgressReport->SetParameterName("b", false);
+    fAsyncProgressReport->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fChunkPolicy = std::make_unique<G4UIcmdWithAString>("/Mustard/Run/ChunkPolicy", this);
+    fChunkPolicy->SetGuidance("Set chunk size policy (Fixed, Guided, Factoring, or CostModel) of dynamic event scheduling. Guided and Factoring shrink chunks as events run out, CostModel sizes chunks from the observed time per event.");
+    fChunkPolicy->SetParameterName("policy", false);
+    fChunkPolicy->SetCandidates("Fixed Guided Factoring CostModel");
+    fChunkPolicy->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fCheckpoint = std::make_unique<G4UIcmdWithAString>("/Mustard/Run/Checkpoint", this);
+    fCheckpoint->SetGuidance("Periodically record processed events of each process to checkpoint files (parallelized as output files). An empty string disables checkpointing.");
+    fCheckpoint->SetParameterName("path", true);
+    fCheckpoint->SetDefaultValue("");
+    fCheckpoint->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fCheckpointPeriod = std::make_unique<G4UIcmdWithAnInteger>("/Mustard/Run/CheckpointPeriod", this);
+    fCheckpointPeriod->SetGuidance("Set period (in seconds) of writing checkpoint files.");
+    fCheckpointPeriod->SetParameterName("seconds", false);
+    fCheckpointPeriod->SetRange("seconds >= 0");
+    fCheckpointPeriod->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fResume = std::make_unique<G4UIcmdWithAString>("/Mustard/Run/Resume", this);
+    fResume->SetGuidance("Skip events recorded in checkpoint files in the next run. All events are processed if no checkpoint is found.");
+    fResume->SetParameterName("path", false);
+    fResume->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fMetrics = std::make_unique<G4UIcmdWithAString>("/Mustard/Run/Metrics", this);
+    fMetrics->SetGuidance("Periodically export run metrics of each process to files. Prometheus textfile format if the extension is .prom (one file per process and a summary file, all flat in the directory of the path), otherwise JSON lines (parallelized as output files). An empty string disables metrics export.");
+    fMetrics->SetParameterName("path", true);
+    fMetrics->SetDefaultValue("");
+    fMetrics->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fMetricsPeriod = std::make_unique<G4UIcmdWithAnInteger>("/Mustard/Run/MetricsPeriod", this);
+    fMetricsPeriod->SetGuidance("Set period (in seconds) of exporting run metrics.");
+    fMetricsPeriod->SetParameterName("seconds", false);
+    fMetricsPeriod->SetRange("seconds >= 0");
+    fMetricsPeriod->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fProfileEventTime = std::make_unique<G4UIcmdWithABool>("/Mustard/Run/ProfileEventTime", this);
+    fProfileEventTime->SetGuidance("Set whether to record processing time of each event. Time percentiles and the slowest events are shown in run summary.");
+    fProfileEventTime->SetParameterName("b", false);
+    fProfileEventTime->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fNSlowestEvent = std::make_unique<G4UIcmdWithAnInteger>("/Mustard/Run/NSlowestEvent", this);
+    fNSlowestEvent->SetGuidance("Set number of the slowest events shown in run summary when event time profiling is enabled.");
+    fNSlowestEvent->SetParameterName("n", false);
+    fNSlowestEvent->SetRange("n >= 0");
+    fNSlowestEvent->AvailableForStates(G4State_PreInit, G4State_Idle);
+
     fPrintRunSummary = std::make_unique<G4UIcommand>("/Mustard/Run/PrintRunSummary", this);
     fPrintRunSummary->SetGuidance("Print MPI run performace summary.");
     fPrintRunSummary->AvailableForStates(G4State_Idle);
@@ -62,6 +127,51 @@ auto MPIRunMessenger::SetNewValue(G4UIcommand* command, G4String value) -> void
         Deliver<MPIRunManager>([&](auto&& r) {
             r.PrintProgressModulo(fPrintProgressModulo->GetNewIntValue(value));
         });
+    } else if (command == fAsyncProgressReport.get()) {
+        Deliver<MPIRunManager>([&](auto&& r) {
+            r.AsyncProgressReport(fAsyncProgressReport->GetNewBoolValue(value));
+        });
+    } else if (command == fChunkPolicy.get()) {
+        Deliver<MPIRunManager>([&](auto&& r) {
+            if (value == "Fixed") {
+                r.ChunkPolicy(MPIX::ChunkSizePolicy::Fixed);
+            } else if (value == "Guided") {
+                r.ChunkPolicy(MPIX::ChunkSizePolicy::Guided);
+            } else if (value == "Factoring") {
+                r.ChunkPolicy(MPIX::ChunkSizePolicy::Factoring);
+            } else if (value == "CostModel") {
+                r.ChunkPolicy(MPIX::ChunkSizePolicy::CostModel);
+            }
+        });
+    } else if (command == fCheckpoint.get()) {
+        Deliver<MPIRunManager>([&](auto&& r) {
+            r.Checkpoint(std::string{value});
+        });
+    } else if (command == fCheckpointPeriod.get()) {
+        Deliver<MPIRunManager>([&](auto&& r) {
+            r.CheckpointPeriod(std::chrono::seconds{fCheckpointPeriod->GetNewIntValue(value)});
+        });
+    } else if (command == fResume.get()) {
+        Deliver<MPIRunManager>([&](auto&& r) {
+            r.Resume(std::string{value});
+        });
+    } else if (command == fMetrics.get()) {
+        Deliver<MPIRunManager>([&](auto&& r) {
+            const std::filesystem::path path{std::string{value}};
+            r.Metrics(path, path.extension() == ".prom" ? MPIX::MetricsFormat::Prometheus : MPIX::MetricsFormat::JSONLines);
+        });
+    } else if (command == fMetricsPeriod.get()) {
+        Deliver<MPIRunManager>([&](auto&& r) {
+            r.MetricsPeriod(std::chrono::seconds{fMetricsPeriod->GetNewIntValue(value)});
+        });
+    } else if (command == fProfileEventTime.get()) {
+        Deliver<MPIRunManager>([&](auto&& r) {
+            r.ProfileEventTime(fProfileEventTime->GetNewBoolValue(value));
+        });
+    } else if (command == fNSlowestEvent.get()) {
+        Deliver<MPIRunManager>([&](auto&& r) {
+            r.NSlowestEvent(fNSlowestEvent->GetNewIntValue(value));
+        });
     } else if (command == fPrintRunSummary.get()) {
         Deliver<MPIRunManager>([&](auto&& r) {
             r.PrintRunSummary();
@@ -23,6 +23,7 @@
 #include <memory>
 
 class G4UIcmdWithABool;
+class G4UIcmdWithAString;
 class G4UIcmdWithAnInteger;
 class G4UIcommand;
 class G4UIdirectory;
@@ -46,6 +47,15 @@ private:
     std::unique_ptr<G4UIdirectory> fDirectory;
     std::unique_ptr<G4UIcmdWithABool> fPrintProgress;
     std::unique_ptr<G4UIcmdWithAnInteger> fPrintProgressModulo;
+    std::unique_ptr<G4UIcmdWithABool> fAsyncProgressReport;
+    std::unique_ptr<G4UIcmdWithAString> fChunkPolicy;
+    std::unique_ptr<G4UIcmdWithAString> fCheckpoint;
+    std::unique_ptr<G4UIcmdWithAnInteger> fCheckpointPeriod;
+    std::unique_ptr<G4UIcmdWithAString> fResume;
+    std::unique_ptr<G4UIcmdWithAString> fMetrics;
+    std::unique_ptr<G4UIcmdWithAnInteger> fMetricsPeriod;
+    std::unique_ptr<G4UIcmdWithABool> fProfileEventTime;
+    std::unique_ptr<G4UIcmdWithAnInteger> fNSlowestEvent;
     std::unique_ptr<G4UIcommand> fPrintRunSummary;
 };
 
@@ -0,0 +1,38 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+namespace Mustard::inline Extension::MPIX::inline Execution {
+
+/// Chunk size policy of schedulers that hand out tasks in chunks (e.g. DynamicScheduler).
+///   Fixed:     fixed chunk size, determined once from the number of tasks.
+///   Guided:    chunk size ~ remaining tasks / (2 * number of processes).
+///   Factoring: chunks are handed out in rounds of one chunk per process,
+///              each round takes half of the remaining tasks.
+///   CostModel: chunk size ~ target chunk time / observed time per task,
+///              bounded above by the guided chunk size. Time per task is
+///              wall time of the process / its completed tasks.
+enum struct ChunkSizePolicy {
+    Fixed,
+    Guided,
+    Factoring,
+    CostModel
+};
+
+} // namespace Mustard::inline Extension::MPIX::inline Execution
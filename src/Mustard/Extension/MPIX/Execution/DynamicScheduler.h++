@@ -20,19 +20,23 @@
 
 #include "Mustard/Env/MPIEnv.h++"
 #include "Mustard/Extension/MPIX/DataType.h++"
+#include "Mustard/Extension/MPIX/Execution/ChunkSizePolicy.h++"
 #include "Mustard/Extension/MPIX/Execution/Scheduler.h++"
 #include "Mustard/Utility/NonMoveableBase.h++"
 #include "Mustard/Utility/PrettyLog.h++"
 
 #include "mpi.h"
 
+#include "muc/time"
 #include "muc/utility"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <concepts>
 #include <cstddef>
 #include <iostream>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <thread>
@@ -46,6 +50,9 @@ class DynamicScheduler : public Scheduler<T> {
 public:
     DynamicScheduler();
 
+    auto ChunkPolicy(ChunkSizePolicy policy) -> void { fChunkPolicy = policy; }
+    auto ChunkPolicy() const -> auto { return fChunkPolicy; }
+
 private:
     virtual auto PreLoopAction() -> void override;
     virtual auto PreTaskAction() -> void override;
@@ -54,7 +61,12 @@ private:
 
     virtual auto NExecutedTask() const -> std::pair<bool, T> override;
 
+    auto GuidedChunkSize(T nRemainedTask) const -> T;
+
 private:
+    using Chunk = typename Scheduler<T>::Task;
+    static_assert(sizeof(Chunk) == 2 * sizeof(T));
+
     class Comm final {
     public:
         Comm();
@@ -92,15 +104,23 @@ private:
             Supervisor(DynamicScheduler<T>* ds);
             ~Supervisor();
 
-            auto FetchAddTaskID() -> T;
+            auto FetchChunk() -> Chunk;
+            auto ObserveTaskTime(double taskTime) -> void;
 
             auto Start() -> void;
 
+        private:
+            auto ChunkSize(T nRemainedTask) -> T;
+
         private:
             DynamicScheduler<T>* const fDS;
-            std::atomic<T> fMainTaskID;
+            std::mutex fMutex;
+            T fMainTaskID;
+            T fFactoringChunkSize;
+            int fFactoringNChunkLeft;
+            double fTaskTime;
             std::vector<MPI_Request> fRecv;
-            std::vector<T> fTaskIDSend;
+            std::vector<Chunk> fChunkSend;
             std::vector<MPI_Request> fSend;
             std::jthread fSupervisorThread;
         };
@@ -108,7 +128,8 @@ private:
     private:
         DynamicScheduler<T>* fDS;
         Supervisor fSupervisor;
-        T fBatchCounter;
+        T fChunkLast;
+        muc::wall_time_stopwatch<> fWallTimeStopwatch;
     };
     friend class Master;
 
@@ -124,18 +145,21 @@ private:
 
     private:
         DynamicScheduler<T>* fDS;
-        T fTaskIDRecv;
+        Chunk fChunkRecv;
         std::array<MPI_Request, 2> fRequest;
-        T fBatchCounter;
+        Chunk fChunk;
     };
     friend class Worker;
 
 private:
     Comm fComm;
+    ChunkSizePolicy fChunkPolicy;
     T fBatchSize;
+    T fInitialChunkSize;
     std::variant<Dummy, Master, Worker> fContext;
 
     static constexpr auto fgBalancingFactor{0.001};
+    static constexpr auto fgCostModelChunkTime{0.01}; // seconds
 };
 
 } // namespace Mustard::inline Extension::MPIX::inline Execution
@@ -22,7 +22,9 @@ template<std::integral T>
 DynamicScheduler<T>::DynamicScheduler() :
     Scheduler<T>{},
     fComm{},
+    fChunkPolicy{},
     fBatchSize{},
+    fInitialChunkSize{},
     fContext{} {
     if (fComm.Rank() == 0) {
         fContext.template emplace<Master>(this);
@@ -65,6 +67,19 @@ template<std::integral T>
 auto DynamicScheduler<T>::PreLoopAction() -> void {
     // width ~ BalanceFactor -> +/- BalanceFactor / 2
     fBatchSize = static_cast<T>(fgBalancingFactor / 2 * static_cast<double>(this->NTask()) / fComm.Size()) + 1;
+    // the first chunk of each process is determined locally
+    switch (fChunkPolicy) {
+    case ChunkSizePolicy::Fixed:
+        fInitialChunkSize = fBatchSize;
+        break;
+    case ChunkSizePolicy::Guided:
+    case ChunkSizePolicy::Factoring:
+        fInitialChunkSize = GuidedChunkSize(this->NTask());
+        break;
+    case ChunkSizePolicy::CostModel:
+        fInitialChunkSize = 1; // probe task time first
+        break;
+    }
     std::visit([](auto&& c) { c.PreLoopAction(); }, fContext);
 }
 
@@ -89,17 +104,27 @@ auto DynamicScheduler<T>::NExecutedTask() const -> std::pair<bool, T> {
             this->fExecutingTask - this->fTask.first};
 }
 
+template<std::integral T>
+auto DynamicScheduler<T>::GuidedChunkSize(T nRemainedTask) const -> T {
+    // ceil(nRemainedTask / (2 * size))
+    return (nRemainedTask - 1) / (2 * fComm.Size()) + 1;
+}
+
 template<std::integral T>
 DynamicScheduler<T>::Master::Supervisor::Supervisor(DynamicScheduler<T>* ds) :
     fDS{ds},
+    fMutex{},
     fMainTaskID{},
+    fFactoringChunkSize{},
+    fFactoringNChunkLeft{},
+    fTaskTime{},
     fRecv{},
-    fTaskIDSend{},
+    fChunkSend{},
     fSend{},
     fSupervisorThread{} {
     if (fDS->fComm.Size() > 1) {
         fRecv.reserve(fDS->fComm.Size() - 1);
-        fTaskIDSend.reserve(fDS->fComm.Size() - 1);
+        fChunkSend.reserve(fDS->fComm.Size() - 1);
         fSend.reserve(fDS->fComm.Size() - 1);
         for (int src{1}; src < fDS->fComm.Size(); ++src) {
             MPI_Recv_init(nullptr,                // buf
@@ -111,13 +136,13 @@ DynamicScheduler<T>::Master::Supervisor::Supervisor(DynamicScheduler<T>* ds) :
                           &fRecv.emplace_back()); // request
         }
         for (int dest{1}; dest < fDS->fComm.Size(); ++dest) {
-            MPI_Rsend_init(&fTaskIDSend.emplace_back(), // buf
-                           1,                           // count
-                           DataType<T>(),               // datatype
-                           dest,                        // dest
-                           1,                           // tag
-                           fDS->fComm,                  // comm
-                           &fSend.emplace_back());      // request
+            MPI_Rsend_init(&fChunkSend.emplace_back(), // buf
+                           2,                          // count
+                           DataType<T>(),              // datatype
+                           dest,                       // dest
+                           1,                          // tag
+                           fDS->fComm,                 // comm
+                           &fSend.emplace_back());     // request
         }
     }
 }
@@ -131,7 +156,10 @@ DynamicScheduler<T>::Master::Supervisor::~Supervisor() {
 
 template<std::integral T>
 auto DynamicScheduler<T>::Master::Supervisor::Start() -> void {
-    fMainTaskID = fDS->fTask.first + fDS->fComm.Size() * fDS->fBatchSize;
+    // with fewer tasks than processes, initial chunks of some processes are empty
+    fMainTaskID = std::min<T>(fDS->fTask.first + fDS->fComm.Size() * fDS->fInitialChunkSize, fDS->fTask.last);
+    fFactoringNChunkLeft = 0; // initial chunks have made up the first round
+    fTaskTime = 0;
     // No need of supervisor in sequential execution
     if (fDS->fComm.Size() == 1) { return; }
     // Check MPI thread support
@@ -172,8 +200,8 @@ auto DynamicScheduler<T>::Master::Supervisor::Start() -> void {
                              MPI_STATUSES_IGNORE); // array_of_statuses
                 for (int i{}; i < cgCount; ++i) {
                     const auto c{cgRank[i]};
-                    fTaskIDSend[c] = FetchAddTaskID();
-                    if (fTaskIDSend[c] != fDS->fTask.last) {
+                    fChunkSend[c] = FetchChunk();
+                    if (fChunkSend[c].first != fDS->fTask.last) {
                         MPI_Start(&fRecv[c]);
                     } else {
                         ++completing;
@@ -192,40 +220,82 @@ auto DynamicScheduler<T>::Master::Supervisor::Start() -> void {
 }
 
 template<std::integral T>
-auto DynamicScheduler<T>::Master::Supervisor::FetchAddTaskID() -> T {
-    return std::min(fMainTaskID.fetch_add(fDS->fBatchSize, std::memory_order::relaxed),
-                    fDS->fTask.last);
+auto DynamicScheduler<T>::Master::Supervisor::FetchChunk() -> Chunk {
+    const std::scoped_lock lock{fMutex};
+    const auto first{fMainTaskID};
+    const auto nRemainedTask{static_cast<T>(fDS->fTask.last - first)};
+    if (nRemainedTask == 0) { return {fDS->fTask.last, fDS->fTask.last}; }
+    fMainTaskID += std::min(ChunkSize(nRemainedTask), nRemainedTask);
+    return {first, fMainTaskID};
+}
+
+template<std::integral T>
+auto DynamicScheduler<T>::Master::Supervisor::ObserveTaskTime(double taskTime) -> void {
+    const std::scoped_lock lock{fMutex};
+    fTaskTime = taskTime;
+}
+
+template<std::integral T>
+auto DynamicScheduler<T>::Master::Supervisor::ChunkSize(T nRemainedTask) -> T {
+    switch (fDS->fChunkPolicy) {
+    case ChunkSizePolicy::Fixed:
+        return fDS->fBatchSize;
+    case ChunkSizePolicy::Guided:
+        return fDS->GuidedChunkSize(nRemainedTask);
+    case ChunkSizePolicy::Factoring:
+        if (fFactoringNChunkLeft == 0) {
+            fFactoringChunkSize = fDS->GuidedChunkSize(nRemainedTask);
+            fFactoringNChunkLeft = fDS->fComm.Size();
+        }
+        --fFactoringNChunkLeft;
+        return fFactoringChunkSize;
+    case ChunkSizePolicy::CostModel: {
+        if (fTaskTime <= 0) { return 1; }
+        const auto guidedChunkSize{fDS->GuidedChunkSize(nRemainedTask)};
+        const auto costModelChunkSize{fgCostModelChunkTime / fTaskTime};
+        if (costModelChunkSize >= guidedChunkSize) { return guidedChunkSize; }
+        return std::max(static_cast<T>(costModelChunkSize), T{1});
+    }
+    }
+    muc::unreachable();
 }
 
 template<std::integral T>
 DynamicScheduler<T>::Master::Master(DynamicScheduler<T>* ds) :
     fDS{ds},
     fSupervisor{ds},
-    fBatchCounter{} {}
+    fChunkLast{},
+    fWallTimeStopwatch{} {}
 
 template<std::integral T>
 auto DynamicScheduler<T>::Master::PreLoopAction() -> void {
     fSupervisor.Start();
     fDS->fExecutingTask = fDS->fTask.first;
-    fBatchCounter = 0;
+    fChunkLast = std::min<T>(fDS->fTask.first + fDS->fInitialChunkSize, fDS->fTask.last);
+    fWallTimeStopwatch = {};
 }
 
 template<std::integral T>
 auto DynamicScheduler<T>::Master::PostTaskAction() -> void {
-    if (++fBatchCounter == fDS->fBatchSize) {
-        fBatchCounter = 0;
-        fDS->fExecutingTask = fSupervisor.FetchAddTaskID();
-    } else {
-        ++fDS->fExecutingTask;
+    if (++fDS->fExecutingTask != fChunkLast) { return; }
+    // with worker threads this runs at dispatch, when possibly no task has completed yet;
+    // the observed time is then kept until some have
+    if (fDS->fChunkPolicy == ChunkSizePolicy::CostModel and fDS->fNLocalExecutedTask > 0) {
+        fSupervisor.ObserveTaskTime(fWallTimeStopwatch.s_elapsed() / fDS->fNLocalExecutedTask);
     }
+    const muc::wall_time_stopwatch<> schedulingStopwatch;
+    const auto chunk{fSupervisor.FetchChunk()};
+    fDS->fSchedulingTime += schedulingStopwatch.s_elapsed();
+    fDS->fExecutingTask = chunk.first;
+    fChunkLast = chunk.last;
 }
 
 template<std::integral T>
 DynamicScheduler<T>::Worker::Worker(DynamicScheduler<T>* ds) :
     fDS{ds},
-    fTaskIDRecv{},
+    fChunkRecv{},
     fRequest{},
-    fBatchCounter{} {
+    fChunk{} {
     auto& [send, recv]{fRequest};
     MPI_Rsend_init(nullptr,      // buf
                    0,            // count
@@ -234,8 +304,8 @@ DynamicScheduler<T>::Worker::Worker(DynamicScheduler<T>* ds) :
                    0,            // tag
                    fDS->fComm,   // comm
                    &send);       // request
-    MPI_Recv_init(&fTaskIDRecv,  // buf
-                  1,             // count
+    MPI_Recv_init(&fChunkRecv,   // buf
+                  2,             // count
                   DataType<T>(), // datatype
                   0,             // source
                   1,             // tag
@@ -252,8 +322,10 @@ DynamicScheduler<T>::Worker::~Worker() {
 
 template<std::integral T>
 auto DynamicScheduler<T>::Worker::PreLoopAction() -> void {
-    fDS->fExecutingTask = fDS->fTask.first + fDS->fComm.Rank() * fDS->fBatchSize;
-    fBatchCounter = 0;
+    // with fewer tasks than processes, the initial chunk can be empty
+    const auto first{std::min<T>(fDS->fTask.first + fDS->fComm.Rank() * fDS->fInitialChunkSize, fDS->fTask.last)};
+    fChunk = {first, std::min<T>(first + fDS->fInitialChunkSize, fDS->fTask.last)};
+    fDS->fExecutingTask = fChunk.first;
     // wait for supervisor to post receive
     MPI_Request firstSupervisorRecvReadyBcast;
     MPI_Ibcast(nullptr,                         // buffer
@@ -264,11 +336,20 @@ auto DynamicScheduler<T>::Worker::PreLoopAction() -> void {
                &firstSupervisorRecvReadyBcast); // request
     MPI_Wait(&firstSupervisorRecvReadyBcast,    // request
              MPI_STATUS_IGNORE);                // status
+    if (fChunk.first == fChunk.last) {
+        // no task to execute: the loop is skipped, but the supervisor still waits for one request,
+        // answered with the final (empty) chunk, received in PostLoopAction
+        fChunk = {fDS->fTask.last, fDS->fTask.last};
+        fDS->fExecutingTask = fDS->fTask.last;
+        auto& [send, recv]{fRequest};
+        MPI_Start(&recv);
+        MPI_Start(&send);
+    }
 }
 
 template<std::integral T>
 auto DynamicScheduler<T>::Worker::PreTaskAction() -> void {
-    if (fBatchCounter == 0) {
+    if (fDS->fExecutingTask == fChunk.first) {
         auto& [send, recv]{fRequest};
         MPI_Start(&recv);
         MPI_Start(&send);
@@ -277,15 +358,14 @@ auto DynamicScheduler<T>::Worker::PreTaskAction() -> void {
 
 template<std::integral T>
 auto DynamicScheduler<T>::Worker::PostTaskAction() -> void {
-    if (++fBatchCounter == fDS->fBatchSize) {
-        fBatchCounter = 0;
-        MPI_Waitall(fRequest.size(),      // count
-                    fRequest.data(),      // array_of_requests
-                    MPI_STATUSES_IGNORE); // array_of_statuses
-        fDS->fExecutingTask = fTaskIDRecv;
-    } else {
-        ++fDS->fExecutingTask;
-    }
+    if (++fDS->fExecutingTask != fChunk.last) { return; }
+    const muc::wall_time_stopwatch<> schedulingStopwatch;
+    MPI_Waitall(fRequest.size(),      // count
+                fRequest.data(),      // array_of_requests
+                MPI_STATUSES_IGNORE); // array_of_statuses
+    fDS->fSchedulingTime += schedulingStopwatch.s_elapsed();
+    fChunk = fChunkRecv;
+    fDS->fExecutingTask = fChunk.first;
 }
 
 template<std::integral T>
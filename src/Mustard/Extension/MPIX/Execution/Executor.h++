@@ -22,8 +22,18 @@
 #include "Mustard/Env/Logging.h++"
 #include "Mustard/Env/MPIEnv.h++"
 #include "Mustard/Env/Print.h++"
+#include "Mustard/Env/Trace.h++"
+#include "Mustard/Extension/MPIX/Execution/ChunkSizePolicy.h++"
 #include "Mustard/Extension/MPIX/Execution/DynamicScheduler.h++"
+#include "Mustard/Extension/MPIX/Execution/MetricsFormat.h++"
 #include "Mustard/Extension/MPIX/Execution/Scheduler.h++"
+#include "Mustard/Extension/MPIX/Execution/internal/AsyncProgressReporter.h++"
+#include "Mustard/Extension/MPIX/Execution/internal/MetricsSink.h++"
+#include "Mustard/Extension/MPIX/Execution/internal/TaskCheckpoint.h++"
+#include "Mustard/Extension/MPIX/Execution/internal/TaskIndexMap.h++"
+#include "Mustard/Extension/MPIX/Execution/internal/TaskProfiler.h++"
+#include "Mustard/Extension/MPIX/Execution/internal/TaskThreadPool.h++"
+#include "Mustard/Extension/MPIX/ParallelizePath.h++"
 #include "Mustard/Utility/PrettyLog.h++"
 
 #include "mpi.h"
@@ -36,19 +46,23 @@
 #include "fmt/format.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <chrono>
 #include <cmath>
 #include <concepts>
 #include <cstdio>
+#include <filesystem>
 #include <functional>
 #include <memory>
 #include <numeric>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <thread>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 namespace Mustard::inline Extension::MPIX::inline Execution {
 
@@ -60,6 +74,7 @@ template<std::integral T>
 class Executor final {
 public:
     using Index = T;
+    using Interval = typename internal::TaskIndexMap<T>::Interval;
 
 public:
     template<template<typename> typename S = DynamicScheduler>
@@ -72,32 +87,78 @@ public:
 
     auto PrintProgress(bool a) -> void { fPrintProgress = a; }
     auto PrintProgressModulo(long long mod) -> void { fPrintProgressModulo = mod; }
+    auto AsyncProgressReport(bool a) -> void { fAsyncProgressReport = a; }
     auto ExecutionName(std::string name) -> void { fExecutionName = std::move(name); }
     auto TaskName(std::string name) -> void { fTaskName = std::move(name); }
     auto FinalPollingPeriod(std::chrono::milliseconds t) -> void { fFinalPollingPeriod = std::move(t); }
+    /// Only for DynamicScheduler (throws std::logic_error otherwise). Reset by SwitchScheduler.
+    auto ChunkPolicy(ChunkSizePolicy policy) -> void;
+    auto Checkpoint(std::filesystem::path path) -> void { fCheckpointPath = std::move(path); }
+    auto CheckpointPeriod(std::chrono::seconds t) -> void { fCheckpointPeriod = std::move(t); }
+    /// Skip tasks recorded in checkpoint at path in the next execution (and only the next one).
+    auto Resume(std::filesystem::path path) -> void { fResumePath = std::move(path); }
+    auto Metrics(std::filesystem::path path, MetricsFormat format = MetricsFormat::JSONLines) -> void { fMetricsPath = std::move(path), fMetricsFormat = format; }
+    auto MetricsPeriod(std::chrono::seconds t) -> void { fMetricsPeriod = std::move(t); }
+    auto ProfileTaskTime(bool a) -> void { fProfileTaskTime = a; }
+    auto NSlowestTask(int n) -> void { fNSlowestTask = n; }
+    /// Execute tasks on n worker threads per process (same on all processes), fed by the scheduler
+    /// through a rank-local queue. With n > 1 the task callback must be thread-safe.
+    /// With n > 1 the scheduler runs when tasks are dispatched to the queue, so the scheduling time
+    /// (see PrintExecutionSummary) measures scheduling at dispatch, not the wait of worker threads.
+    auto NThread(int n) -> void { fNThread = n; }
 
     auto Task() const -> auto { return fScheduler->fTask; }
     auto NTask() const -> T { return fScheduler->NTask(); }
     auto Executing() const -> bool { return fExecuting; }
+    auto AsyncProgressReport() const -> auto { return fAsyncProgressReport; }
+    auto ChunkPolicy() const -> ChunkSizePolicy;
+    auto Checkpoint() const -> const auto& { return fCheckpointPath; }
+    auto CheckpointPeriod() const -> auto { return fCheckpointPeriod; }
+    auto Metrics() const -> const auto& { return fMetricsPath; }
+    auto MetricsPeriod() const -> auto { return fMetricsPeriod; }
+    auto ProfileTaskTime() const -> auto { return fProfileTaskTime; }
+    auto NSlowestTask() const -> auto { return fNSlowestTask; }
+    auto NThread() const -> auto { return fNThread; }
 
     auto Execute(typename Scheduler<T>::Task task, std::invocable<T> auto&& F) -> T;
     auto Execute(T size, std::invocable<T> auto&& F) -> T { return Execute({0, size}, std::forward<decltype(F)>(F)); }
+    /// Execute tasks in a set of intervals [first, last). Intervals can be unsorted, overlapped or adjacent.
+    auto Execute(std::span<const Interval> taskSet, std::invocable<T> auto&& F) -> T;
+    /// Execute tasks in a strictly ascending list of task indices.
+    auto Execute(std::span<const T> sortedTask, std::invocable<T> auto&& F) -> T;
 
     auto ExecutingTask() const -> T { return fScheduler->fExecutingTask; }
     auto NLocalExecutedTask() const -> T { return fScheduler->fNLocalExecutedTask; }
+    /// Index of the worker thread executing the current task, in [0, NThread()).
+    /// Useful for indexing per-thread states in task callback.
+    static auto ThreadIndex() -> int { return internal::TaskThreadPool<T>::ThreadIndex(); }
 
     auto PrintExecutionSummary() const -> void;
 
 private:
+    /// taskSet should be sorted, disjoint and without empty interval.
+    auto ExecuteTaskSet(std::vector<Interval> taskSet, std::invocable<T> auto&& F) -> T;
+
+    auto LoadCheckpoint(typename Scheduler<T>::Task task) const -> std::vector<Interval>;
+
     auto PreLoopReport() const -> void;
     auto PostTaskReport(T iEnded) const -> void;
+    auto PeriodicAction(T iEnded) -> void;
+    auto AsyncReport(T nLocalExecutedTask) const -> void;
+    auto ProgressReport(std::optional<T> iEnded, T nLocalExecutedTask, std::pair<bool, T> nExecutedTask, double secondsElapsed) const -> void;
+    auto MetricsSnapshot(double wallTime) -> void;
     auto PostLoopReport() const -> void;
+    auto PrintTimeBreakdown() const -> void;
+    auto PrintThreadSummary() const -> void;
 
     static auto SToDHMS(double s) -> std::string;
 
 private:
     using scsc = std::chrono::system_clock;
 
+    static constexpr auto fgClockCheckPeriod{0.01};
+    static constexpr auto fgProgressReportPeriod{3.};
+
 private:
     std::unique_ptr<Scheduler<T>> fScheduler;
 
@@ -105,12 +166,40 @@ private:
 
     bool fPrintProgress;
     long long fPrintProgressModulo;
+    bool fAsyncProgressReport;
+    std::unique_ptr<internal::AsyncProgressReporter<T>> fAsyncProgressReporter;
+    double fNextReportTime;
+
+    long long fClockCheckInterval;
+    long long fClockCheckCountdown;
+    double fLastClockCheckTime;
 
     std::string fExecutionName;
     std::string fTaskName;
 
     std::chrono::milliseconds fFinalPollingPeriod;
 
+    std::filesystem::path fCheckpointPath;
+    std::chrono::seconds fCheckpointPeriod;
+    std::filesystem::path fResumePath;
+    internal::TaskIndexMap<T> fTaskIndexMap;
+    std::unique_ptr<internal::TaskCheckpoint<T>> fCheckpoint;
+    double fNextCheckpointTime;
+
+    std::filesystem::path fMetricsPath;
+    MetricsFormat fMetricsFormat;
+    std::chrono::seconds fMetricsPeriod;
+    std::unique_ptr<internal::MetricsSink> fMetricsSink;
+    double fNextMetricsTime;
+
+    bool fProfileTaskTime;
+    int fNSlowestTask;
+    std::unique_ptr<internal::TaskProfiler<T>> fTaskProfiler;
+
+    int fNThread;
+    std::vector<T> fThreadNExecutedTask;
+    std::vector<double> fThreadBusyTime;
+
     scsc::time_point fExecutionBeginSystemTime;
     muc::wall_time_stopwatch<> fWallTimeStopwatch;
     muc::cpu_time_stopwatch<> fCPUTimeStopwatch;
@@ -120,6 +209,10 @@ private:
     std::vector<T> fNLocalExecutedTaskOfAllProcessKeptByMaster;
     std::vector<double> fExecutionWallTimeOfAllProcessKeptByMaster;
     std::vector<double> fExecutionCPUTimeOfAllProcessKeptByMaster;
+    std::vector<double> fSchedulingTimeOfAllProcessKeptByMaster;
+    std::vector<int> fNodeIDOfAllProcessKeptByMaster;
+    std::vector<T> fThreadNExecutedTaskOfAllProcessKeptByMaster;
+    std::vector<double> fThreadBusyTimeOfAllProcessKeptByMaster;
 };
 
 } // namespace Mustard::inline Extension::MPIX::inline Execution
@@ -19,6 +19,7 @@
 namespace Mustard::inline Extension::MPIX::inline Execution {
 
 using std::chrono_literals::operator""ms;
+using std::chrono_literals::operator""s;
 
 template<std::integral T>
     requires(Concept::MPIPredefined<T> and sizeof(T) >= sizeof(short))
@@ -29,9 +30,32 @@ Executor<T>::Executor(ScheduleBy<S>) :
     fExecuting{},
     fPrintProgress{true},
     fPrintProgressModulo{},
+    fAsyncProgressReport{},
+    fAsyncProgressReporter{},
+    fNextReportTime{},
+    fClockCheckInterval{},
+    fClockCheckCountdown{},
+    fLastClockCheckTime{},
     fExecutionName{"Execution"},
     fTaskName{"Task"},
     fFinalPollingPeriod{20ms},
+    fCheckpointPath{},
+    fCheckpointPeriod{60s},
+    fResumePath{},
+    fTaskIndexMap{},
+    fCheckpoint{},
+    fNextCheckpointTime{},
+    fMetricsPath{},
+    fMetricsFormat{},
+    fMetricsPeriod{10s},
+    fMetricsSink{},
+    fNextMetricsTime{},
+    fProfileTaskTime{},
+    fNSlowestTask{10},
+    fTaskProfiler{},
+    fNThread{1},
+    fThreadNExecutedTask{},
+    fThreadBusyTime{},
     fExecutionBeginSystemTime{},
     fWallTimeStopwatch{},
     fCPUTimeStopwatch{},
@@ -39,12 +63,18 @@ Executor<T>::Executor(ScheduleBy<S>) :
     fExecutionCPUTime{},
     fNLocalExecutedTaskOfAllProcessKeptByMaster{},
     fExecutionWallTimeOfAllProcessKeptByMaster{},
-    fExecutionCPUTimeOfAllProcessKeptByMaster{} {
+    fExecutionCPUTimeOfAllProcessKeptByMaster{},
+    fSchedulingTimeOfAllProcessKeptByMaster{},
+    fNodeIDOfAllProcessKeptByMaster{},
+    fThreadNExecutedTaskOfAllProcessKeptByMaster{},
+    fThreadBusyTimeOfAllProcessKeptByMaster{} {
     if (const auto& mpiEnv{Env::MPIEnv::Instance()};
         mpiEnv.OnCommWorldMaster()) {
         fNLocalExecutedTaskOfAllProcessKeptByMaster.resize(mpiEnv.CommWorldSize());
         fExecutionWallTimeOfAllProcessKeptByMaster.resize(mpiEnv.CommWorldSize());
         fExecutionCPUTimeOfAllProcessKeptByMaster.resize(mpiEnv.CommWorldSize());
+        fSchedulingTimeOfAllProcessKeptByMaster.resize(mpiEnv.CommWorldSize());
+        fNodeIDOfAllProcessKeptByMaster.resize(mpiEnv.CommWorldSize());
     }
 }
 
@@ -59,16 +89,135 @@ auto Executor<T>::SwitchScheduler() -> void {
     fScheduler->fTask = std::move(task);
 }
 
+template<std::integral T>
+    requires(Concept::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto Executor<T>::ChunkPolicy(ChunkSizePolicy policy) -> void {
+    const auto dynamicScheduler{dynamic_cast<DynamicScheduler<T>*>(fScheduler.get())};
+    if (dynamicScheduler == nullptr) { throw std::logic_error{PrettyException("Chunk size policy is only available for DynamicScheduler")}; }
+    dynamicScheduler->ChunkPolicy(policy);
+}
+
+template<std::integral T>
+    requires(Concept::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto Executor<T>::ChunkPolicy() const -> ChunkSizePolicy {
+    const auto dynamicScheduler{dynamic_cast<const DynamicScheduler<T>*>(fScheduler.get())};
+    if (dynamicScheduler == nullptr) { throw std::logic_error{PrettyException("Chunk size policy is only available for DynamicScheduler")}; }
+    return dynamicScheduler->ChunkPolicy();
+}
+
 template<std::integral T>
     requires(Concept::MPIPredefined<T> and sizeof(T) >= sizeof(short))
 auto Executor<T>::Execute(typename Scheduler<T>::Task task, std::invocable<T> auto&& F) -> T {
-    // reset
     if (task.last < task.first) { throw std::invalid_argument{PrettyException("task.last < task.first")}; }
     if (task.last == task.first) { return 0; }
-    if (task.last - task.first < static_cast<T>(Env::MPIEnv::Instance().CommWorldSize())) {
-        throw std::runtime_error{PrettyException("Number of tasks < size of MPI_COMM_WORLD")};
+    return ExecuteTaskSet({{task.first, task.last}}, std::forward<decltype(F)>(F));
+}
+
+template<std::integral T>
+    requires(Concept::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto Executor<T>::Execute(std::span<const Interval> taskSet, std::invocable<T> auto&& F) -> T {
+    std::vector<Interval> interval;
+    interval.reserve(taskSet.size());
+    for (auto&& [first, last] : taskSet) {
+        if (last < first) { throw std::invalid_argument{PrettyException("Interval with last < first")}; }
+        if (last == first) { continue; }
+        interval.push_back({first, last});
     }
-    fScheduler->fTask = task;
+    std::ranges::sort(interval, {}, &Interval::first);
+    // merge overlapped or adjacent intervals
+    std::vector<Interval> merged;
+    merged.reserve(interval.size());
+    for (auto&& [first, last] : interval) {
+        if (not merged.empty() and first <= merged.back().last) {
+            merged.back().last = std::max(merged.back().last, last);
+        } else {
+            merged.push_back({first, last});
+        }
+    }
+    return ExecuteTaskSet(std::move(merged), std::forward<decltype(F)>(F));
+}
+
+template<std::integral T>
+    requires(Concept::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto Executor<T>::Execute(std::span<const T> sortedTask, std::invocable<T> auto&& F) -> T {
+    if (std::ranges::adjacent_find(sortedTask, std::greater_equal{}) != sortedTask.end()) {
+        throw std::invalid_argument{PrettyException("Task indices are not strictly ascending")};
+    }
+    // compress runs of consecutive indices into intervals
+    std::vector<Interval> taskSet;
+    for (auto&& i : sortedTask) {
+        if (not taskSet.empty() and i == taskSet.back().last) {
+            ++taskSet.back().last;
+        } else {
+            taskSet.push_back({i, static_cast<T>(i + 1)});
+        }
+    }
+    return ExecuteTaskSet(std::move(taskSet), std::forward<decltype(F)>(F));
+}
+
+template<std::integral T>
+    requires(Concept::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto Executor<T>::ExecuteTaskSet(std::vector<Interval> taskSet, std::invocable<T> auto&& F) -> T {
+    // reset
+    if (taskSet.empty()) { return 0; }
+    MUSTARD_TRACE_SCOPE("MPIX::Executor::Execute");
+    const typename Scheduler<T>::Task task{taskSet.front().first, taskSet.back().last};
+    // resume from checkpoint
+    std::vector<Interval> executed;
+    if (not fResumePath.empty()) {
+        executed = LoadCheckpoint(task);
+    }
+    if (not executed.empty()) {
+        const auto nTask{std::transform_reduce(taskSet.cbegin(), taskSet.cend(), 0ull, std::plus{},
+                                               [](auto&& i) { return static_cast<unsigned long long>(i.last - i.first); })};
+        // subtract executed intervals from task set
+        std::vector<Interval> remained;
+        auto e{executed.cbegin()};
+        for (auto [first, last] : taskSet) {
+            while (e != executed.cend() and e->last <= first) { ++e; }
+            for (auto f{e}; f != executed.cend() and f->first < last; ++f) {
+                if (first < f->first) { remained.push_back({first, f->first}); }
+                first = std::max(first, f->last);
+            }
+            if (first < last) { remained.push_back({first, last}); }
+        }
+        taskSet = std::move(remained);
+        if (Env::MPIEnv::Instance().OnCommWorldMaster() and fPrintProgress) {
+            const auto nRemained{std::transform_reduce(taskSet.cbegin(), taskSet.cend(), 0ull, std::plus{},
+                                                       [](auto&& i) { return static_cast<unsigned long long>(i.last - i.first); })};
+            Env::PrintLn("Resuming from checkpoint '{}': {} of {} {}s have been executed",
+                         fResumePath.generic_string(), nTask - nRemained, nTask, fTaskName);
+        }
+    }
+    fResumePath.clear();
+    if (taskSet.empty()) { return 0; }
+    // a single interval is scheduled directly, otherwise schedule compact indices and map them onto task set
+    typename Scheduler<T>::Task taskToSchedule{taskSet.front().first, taskSet.front().last};
+    fTaskIndexMap = {};
+    if (taskSet.size() > 1) {
+        fTaskIndexMap = internal::TaskIndexMap<T>{std::move(taskSet)};
+        taskToSchedule = {0, fTaskIndexMap.Size()};
+    }
+    if (fNThread < 1) { throw std::invalid_argument{PrettyException("Number of threads < 1")}; }
+    // checkpoint
+    if (not fCheckpointPath.empty()) {
+        fCheckpoint = std::make_unique<internal::TaskCheckpoint<T>>(ParallelizePath(fCheckpointPath), Interval{task.first, task.last});
+        if (Env::MPIEnv::Instance().OnCommWorldMaster()) {
+            // keep previously executed tasks for next resume
+            for (auto&& interval : executed) { fCheckpoint->Record(interval); }
+            fCheckpoint->Flush();
+        }
+    }
+    // metrics
+    if (not fMetricsPath.empty()) {
+        fMetricsSink = std::make_unique<internal::MetricsSink>(fMetricsPath, fMetricsFormat, fExecutionName);
+    }
+    // task time profiling
+    fTaskProfiler = fProfileTaskTime ? std::make_unique<internal::TaskProfiler<T>>(fNSlowestTask) : nullptr;
+    // per-thread statistics
+    fThreadNExecutedTask.assign(fNThread > 1 ? fNThread : 0, 0);
+    fThreadBusyTime.assign(fNThread > 1 ? fNThread : 0, 0);
+    fScheduler->fTask = taskToSchedule;
     fScheduler->Reset();
     assert(ExecutingTask() == Task().first);
     assert(NLocalExecutedTask() == 0);
@@ -80,45 +229,107 @@ auto Executor<T>::Execute(typename Scheduler<T>::Task task, std::invocable<T> au
     fExecutionBeginSystemTime = scsc::now();
     fWallTimeStopwatch = {};
     fCPUTimeStopwatch = {};
+    fClockCheckInterval = 1;
+    fClockCheckCountdown = 1;
+    fLastClockCheckTime = 0;
+    // progress reports of processes are staggered, ~1 report per fgProgressReportPeriod in total
+    const auto& mpiEnv{Env::MPIEnv::Instance()};
+    fNextReportTime = fgProgressReportPeriod * (mpiEnv.CommWorldRank() + 1);
+    fNextMetricsTime = fMetricsPeriod.count();
+    fNextCheckpointTime = fCheckpointPeriod.count();
+    if (fPrintProgress and fPrintProgressModulo == 0 and fAsyncProgressReport) {
+        fAsyncProgressReporter = std::make_unique<internal::AsyncProgressReporter<T>>(
+            std::chrono::duration<double>{fNextReportTime},
+            std::chrono::duration<double>{fgProgressReportPeriod * mpiEnv.CommWorldSize()},
+            [this](T n) { AsyncReport(n); });
+    }
     PreLoopReport();
     // main loop
-    while (ExecutingTask() != Task().last) {
-        fScheduler->PreTaskAction();
-        const auto taskID{ExecutingTask()};
-        assert(taskID <= Task().last);
-        std::invoke(std::forward<decltype(F)>(F), taskID);
-        ++fScheduler->fNLocalExecutedTask;
-        fScheduler->PostTaskAction();
-        PostTaskReport(taskID);
+    if (fNThread == 1) {
+        while (ExecutingTask() != Task().last) {
+            fScheduler->PreTaskAction();
+            assert(ExecutingTask() < Task().last);
+            const auto taskID{fTaskIndexMap.Empty() ? ExecutingTask() : fTaskIndexMap[ExecutingTask()]};
+            const auto taskBeginTime{fTaskProfiler ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{}};
+            {
+                MUSTARD_TRACE_SCOPE("MPIX::Executor::Task", taskID);
+                std::invoke(std::forward<decltype(F)>(F), taskID);
+            }
+            if (fTaskProfiler) { fTaskProfiler->Record(taskID, std::chrono::steady_clock::now() - taskBeginTime); }
+            ++fScheduler->fNLocalExecutedTask;
+            if (fCheckpoint) { fCheckpoint->Record(taskID); }
+            fScheduler->PostTaskAction();
+            if (fAsyncProgressReporter) { fAsyncProgressReporter->Publish(NLocalExecutedTask()); }
+            if (fPrintProgressModulo > 0) { PostTaskReport(taskID); }
+            if (--fClockCheckCountdown == 0) { PeriodicAction(taskID); }
+        }
+    } else {
+        // this thread schedules tasks and does all bookkeeping (and all MPI calls), worker threads execute tasks
+        internal::TaskThreadPool<T> threadPool{fNThread, [&F](T taskID) {
+                                                   MUSTARD_TRACE_SCOPE("MPIX::Executor::Task", taskID);
+                                                   std::invoke(F, taskID);
+                                               }};
+        std::vector<typename internal::TaskThreadPool<T>::Completion> completion;
+        while (true) {
+            // keep ~2 tasks per thread in the rank-local queue, so that scheduling follows the execution
+            while (ExecutingTask() != Task().last and threadPool.NInFlight() < 2 * fNThread) {
+                fScheduler->PreTaskAction();
+                assert(ExecutingTask() < Task().last);
+                threadPool.Push(fTaskIndexMap.Empty() ? ExecutingTask() : fTaskIndexMap[ExecutingTask()]);
+                fScheduler->PostTaskAction();
+            }
+            if (threadPool.NInFlight() == 0) { break; }
+            threadPool.Collect(completion);
+            for (auto&& [taskID, time, thread] : completion) {
+                if (fTaskProfiler) { fTaskProfiler->Record(taskID, time); }
+                ++fScheduler->fNLocalExecutedTask;
+                ++fThreadNExecutedTask[thread];
+                fThreadBusyTime[thread] += std::chrono::duration<double>{time}.count();
+                if (fCheckpoint) { fCheckpoint->Record(taskID); }
+                if (fAsyncProgressReporter) { fAsyncProgressReporter->Publish(NLocalExecutedTask()); }
+                if (fPrintProgressModulo > 0) { PostTaskReport(taskID); }
+                if (--fClockCheckCountdown == 0) { PeriodicAction(taskID); }
+            }
+        }
     }
     // finalize
+    fAsyncProgressReporter.reset();
+    fCheckpoint.reset();
     fExecutionWallTime = fWallTimeStopwatch.s_elapsed();
     fExecutionCPUTime = fCPUTimeStopwatch.s_used();
     MPI_Request barrierRequest;
     MPI_Ibarrier(MPI_COMM_WORLD, &barrierRequest);
     struct GatheringDataType {
         T nLocalExecutedTask;
+        int nodeID;
         double wallTime;
         double cpuTime;
+        double schedulingTime;
     };
     MPI_Datatype gatheringDataType;
-    MPI_Type_create_struct(3,                                                                       // count
-                           std::array<int, 3>{1,                                                    // array_of_block_lengths
+    MPI_Type_create_struct(5,                                                                       // count
+                           std::array<int, 5>{1,                                                    // array_of_block_lengths
+                                              1,                                                    // array_of_block_lengths
+                                              1,                                                    // array_of_block_lengths
                                               1,                                                    // array_of_block_lengths
                                               1}                                                    // array_of_block_lengths
                                .data(),                                                             // array_of_block_lengths
-                           std::array<MPI_Aint, 3>{offsetof(GatheringDataType, nLocalExecutedTask), // array_of_displacements
+                           std::array<MPI_Aint, 5>{offsetof(GatheringDataType, nLocalExecutedTask), // array_of_displacements
+                                                   offsetof(GatheringDataType, nodeID),             // array_of_displacements
                                                    offsetof(GatheringDataType, wallTime),           // array_of_displacements
-                                                   offsetof(GatheringDataType, cpuTime)}            // array_of_displacements
+                                                   offsetof(GatheringDataType, cpuTime),            // array_of_displacements
+                                                   offsetof(GatheringDataType, schedulingTime)}     // array_of_displacements
                                .data(),                                                             // array_of_displacements
-                           std::array<MPI_Datatype, 3>{DataType<T>(),                               // array_of_types
+                           std::array<MPI_Datatype, 5>{DataType<T>(),                               // array_of_types
+                                                       MPI_INT,                                     // array_of_types
+                                                       MPI_DOUBLE,                                  // array_of_types
                                                        MPI_DOUBLE,                                  // array_of_types
                                                        MPI_DOUBLE}                                  // array_of_types
                                .data(),                                                             // array_of_types
                            &gatheringDataType);                                                     // newtype
-    GatheringDataType gatheringData{fScheduler->fNLocalExecutedTask, fExecutionWallTime, fExecutionCPUTime};
+    GatheringDataType gatheringData{fScheduler->fNLocalExecutedTask, mpiEnv.LocalNodeID(),
+                                    fExecutionWallTime, fExecutionCPUTime, fScheduler->fSchedulingTime};
     std::vector<GatheringDataType> masterGatheredData;
-    const auto& mpiEnv{Env::MPIEnv::Instance()};
     if (mpiEnv.OnCommWorldMaster()) {
         masterGatheredData.resize(mpiEnv.CommWorldSize());
     }
@@ -134,6 +345,29 @@ auto Executor<T>::Execute(typename Scheduler<T>::Task task, std::invocable<T> au
                 MPI_COMM_WORLD,            // comm
                 &gatherRequest);           // request
     MPI_Type_free(&gatheringDataType);
+    if (mpiEnv.OnCommWorldMaster()) {
+        fThreadNExecutedTaskOfAllProcessKeptByMaster.resize(fThreadNExecutedTask.size() * mpiEnv.CommWorldSize());
+        fThreadBusyTimeOfAllProcessKeptByMaster.resize(fThreadBusyTime.size() * mpiEnv.CommWorldSize());
+    }
+    std::array<MPI_Request, 2> threadGatherRequest;
+    MPI_Igather(fThreadNExecutedTask.data(),                         // sendbuf
+                fThreadNExecutedTask.size(),                         // sendcount
+                DataType<T>(),                                       // sendtype
+                fThreadNExecutedTaskOfAllProcessKeptByMaster.data(), // recvbuf
+                fThreadNExecutedTask.size(),                         // recvcount
+                DataType<T>(),                                       // recvtype
+                0,                                                   // root
+                MPI_COMM_WORLD,                                      // comm
+                &threadGatherRequest[0]);                            // request
+    MPI_Igather(fThreadBusyTime.data(),                              // sendbuf
+                fThreadBusyTime.size(),                              // sendcount
+                MPI_DOUBLE,                                          // sendtype
+                fThreadBusyTimeOfAllProcessKeptByMaster.data(),      // recvbuf
+                fThreadBusyTime.size(),                              // recvcount
+                MPI_DOUBLE,                                          // recvtype
+                0,                                                   // root
+                MPI_COMM_WORLD,                                      // comm
+                &threadGatherRequest[1]);                            // request
     fScheduler->PostLoopAction();
     fExecuting = false;
     while (true) {
@@ -143,13 +377,40 @@ auto Executor<T>::Execute(typename Scheduler<T>::Task task, std::invocable<T> au
         std::this_thread::sleep_for(fFinalPollingPeriod);
     }
     MPI_Wait(&gatherRequest, MPI_STATUS_IGNORE);
+    MPI_Waitall(threadGatherRequest.size(), threadGatherRequest.data(), MPI_STATUSES_IGNORE);
+    if (fTaskProfiler) { fTaskProfiler->Merge(); }
     if (mpiEnv.OnCommWorldMaster()) {
         for (int rank{}; rank < mpiEnv.CommWorldSize(); ++rank) {
             fNLocalExecutedTaskOfAllProcessKeptByMaster[rank] = masterGatheredData[rank].nLocalExecutedTask;
             fExecutionWallTimeOfAllProcessKeptByMaster[rank] = masterGatheredData[rank].wallTime;
             fExecutionCPUTimeOfAllProcessKeptByMaster[rank] = masterGatheredData[rank].cpuTime;
+            fSchedulingTimeOfAllProcessKeptByMaster[rank] = masterGatheredData[rank].schedulingTime;
+            fNodeIDOfAllProcessKeptByMaster[rank] = masterGatheredData[rank].nodeID;
         }
     }
+    if (fMetricsSink) {
+        fMetricsSink->Write({mpiEnv.CommWorldRank(),
+                             std::chrono::duration<double>{scsc::now().time_since_epoch()}.count(),
+                             static_cast<unsigned long long>(NTask()),
+                             static_cast<unsigned long long>(NTask()),
+                             static_cast<unsigned long long>(NLocalExecutedTask()),
+                             NTask() / fExecutionWallTime,
+                             0.,
+                             fExecutionWallTime,
+                             fExecutionCPUTime,
+                             std::max(0., fExecutionWallTime - fExecutionCPUTime)});
+        if (mpiEnv.OnCommWorldMaster()) {
+            std::vector<internal::MetricsSink::RankSummary> summary;
+            summary.reserve(mpiEnv.CommWorldSize());
+            for (int rank{}; rank < mpiEnv.CommWorldSize(); ++rank) {
+                const auto& data{masterGatheredData[rank]};
+                summary.push_back({rank, static_cast<unsigned long long>(data.nLocalExecutedTask),
+                                   data.wallTime, data.cpuTime, std::max(0., data.wallTime - data.cpuTime)});
+            }
+            fMetricsSink->WriteSummary(std::chrono::duration<double>{scsc::now().time_since_epoch()}.count(), static_cast<unsigned long long>(NTask()), summary);
+        }
+        fMetricsSink.reset();
+    }
     PostLoopReport();
     return NLocalExecutedTask();
 }
@@ -173,6 +434,133 @@ auto Executor<T>::PrintExecutionSummary() const -> void {
         Env::PrintLn("| {:16} | {:17} | {:16.3f} | {:17.3f} |", rank, executed, wallTime, cpuTime);
     }
     Env::PrintLn("+------------------+--------------> Summary <-------------+-------------------+");
+    PrintTimeBreakdown();
+    PrintThreadSummary();
+    if (not fTaskProfiler) { return; }
+    const auto& profiler{*fTaskProfiler};
+    Env::Print("+------------------+-------------> Task time <------------+-------------------+\n"
+               "| Mean (s)         | Min (s)           | Max (s)          | Count             |\n"
+               "| {:16.6g} | {:17.6g} | {:16.6g} | {:17} |\n"
+               "+------------------+-------------------+------------------+-------------------+\n"
+               "| p50 (s)          | p90 (s)           | p99 (s)          | p99.9 (s)         |\n"
+               "| {:16.6g} | {:17.6g} | {:16.6g} | {:17.6g} |\n",
+               profiler.MeanTime(), profiler.MinTime(), profiler.MaxTime(), profiler.NTask(),
+               profiler.Percentile(0.5), profiler.Percentile(0.9), profiler.Percentile(0.99), profiler.Percentile(0.999));
+    if (profiler.Slowest().empty()) {
+        Env::PrintLn("+------------------+-------------> Task time <------------+-------------------+");
+        return;
+    }
+    const auto median{profiler.Percentile(0.5)};
+    Env::Print("+------------------+-----------> Slowest tasks <----------+-------------------+\n"
+               "| Rank in world    | {:17} | Time (s)         | Time / median     |\n"
+               "+------------------+-------------------+------------------+-------------------+\n",
+               fTaskName);
+    for (auto&& [time, task, rank] : profiler.Slowest()) {
+        Env::PrintLn("| {:16} | {:17} | {:16.6g} | {:17.1f} |", rank, task, time, time / median);
+    }
+    Env::PrintLn("+------------------+-----------> Slowest tasks <----------+-------------------+");
+}
+
+template<std::integral T>
+    requires(Concept::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto Executor<T>::PrintTimeBreakdown() const -> void {
+    // wall time of a process = compute + scheduling, then it waits for the slowest process at the final barrier
+    const auto& mpiEnv{Env::MPIEnv::Instance()};
+    const auto size{mpiEnv.CommWorldSize()};
+    const auto maxWallTime{*std::ranges::max_element(fExecutionWallTimeOfAllProcessKeptByMaster)};
+    std::vector<double> computeTime(size);
+    std::vector<double> finalWaitTime(size);
+    for (int rank{}; rank < size; ++rank) {
+        const auto& wallTime{fExecutionWallTimeOfAllProcessKeptByMaster[rank]};
+        computeTime[rank] = std::max(0., wallTime - fSchedulingTimeOfAllProcessKeptByMaster[rank]);
+        finalWaitTime[rank] = maxWallTime - wallTime;
+    }
+    const auto totalComputeTime{muc::ranges::reduce(computeTime)};
+    const auto maxComputeTime{*std::ranges::max_element(computeTime)};
+    const auto meanComputeTime{totalComputeTime / size};
+    Env::Print("+------------------+----------> Time breakdown <----------+-------------------+\n"
+               "| Rank in world    | Compute (s)       | Scheduling (s)   | Final wait (s)    |\n"
+               "+------------------+-------------------+------------------+-------------------+\n");
+    for (int rank{}; rank < size; ++rank) {
+        Env::PrintLn("| {:16} | {:17.3f} | {:16.3f} | {:17.3f} |",
+                     rank, computeTime[rank], fSchedulingTimeOfAllProcessKeptByMaster[rank], finalWaitTime[rank]);
+    }
+    Env::Print("+------------------+-------------------+------------------+-------------------+\n"
+               "| Max/mean compute | {:17.3f} | Par. efficiency  | {:16.1f}% |\n",
+               meanComputeTime > 0 ? maxComputeTime / meanComputeTime : 1,
+               maxWallTime > 0 ? 100 * totalComputeTime / (size * maxWallTime) : 100);
+    if (mpiEnv.OnSingleNode()) {
+        Env::PrintLn("+------------------+----------> Time breakdown <----------+-------------------+");
+        return;
+    }
+    // per-node aggregates
+    struct NodeSummary {
+        unsigned long long nExecutedTask;
+        double computeTime;
+        double idleTime;
+    };
+    std::vector<NodeSummary> nodeSummary(mpiEnv.ClusterSize());
+    for (int rank{}; rank < size; ++rank) {
+        auto& node{nodeSummary[fNodeIDOfAllProcessKeptByMaster[rank]]};
+        node.nExecutedTask += fNLocalExecutedTaskOfAllProcessKeptByMaster[rank];
+        node.computeTime += computeTime[rank];
+        node.idleTime += fSchedulingTimeOfAllProcessKeptByMaster[rank] + finalWaitTime[rank];
+    }
+    Env::Print("+------------------+-----------> Node summary <-----------+-------------------+\n"
+               "| Node             | Executed          | Mean compute (s) | Mean idle (s)     |\n"
+               "+------------------+-------------------+------------------+-------------------+\n");
+    for (int id{}; id < mpiEnv.ClusterSize(); ++id) {
+        const auto& [nodeSize, name]{mpiEnv.Node(id)};
+        const auto& [nExecutedTask, nodeComputeTime, nodeIdleTime]{nodeSummary[id]};
+        Env::PrintLn("| {:16.16} | {:17} | {:16.3f} | {:17.3f} |",
+                     name, nExecutedTask, nodeComputeTime / nodeSize, nodeIdleTime / nodeSize);
+    }
+    Env::PrintLn("+------------------+-----------> Node summary <-----------+-------------------+");
+}
+
+template<std::integral T>
+    requires(Concept::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto Executor<T>::PrintThreadSummary() const -> void {
+    if (fThreadBusyTimeOfAllProcessKeptByMaster.empty()) { return; }
+    const auto size{Env::MPIEnv::Instance().CommWorldSize()};
+    const auto nThread{ssize(fThreadBusyTimeOfAllProcessKeptByMaster) / size};
+    Env::Print("+------------------+----------> Thread summary <----------+-------------------+\n"
+               "| Rank/thread      | Executed          | Busy time (s)    | Utilization       |\n"
+               "+------------------+-------------------+------------------+-------------------+\n");
+    for (int rank{}; rank < size; ++rank) {
+        const auto& wallTime{fExecutionWallTimeOfAllProcessKeptByMaster[rank]};
+        for (int thread{}; thread < nThread; ++thread) {
+            const auto& executed{fThreadNExecutedTaskOfAllProcessKeptByMaster[rank * nThread + thread]};
+            const auto& busyTime{fThreadBusyTimeOfAllProcessKeptByMaster[rank * nThread + thread]};
+            Env::PrintLn("| {:16} | {:17} | {:16.3f} | {:16.1f}% |",
+                         fmt::format("{}/{}", rank, thread), executed, busyTime, wallTime > 0 ? 100 * busyTime / wallTime : 100);
+        }
+    }
+    Env::PrintLn("+------------------+----------> Thread summary <----------+-------------------+");
+}
+
+template<std::integral T>
+    requires(Concept::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto Executor<T>::LoadCheckpoint(typename Scheduler<T>::Task task) const -> std::vector<Interval> {
+    static_assert(sizeof(Interval) == 2 * sizeof(T));
+    std::vector<Interval> executed;
+    const auto& mpiEnv{Env::MPIEnv::Instance()};
+    if (mpiEnv.OnCommWorldMaster()) {
+        executed = internal::TaskCheckpoint<T>::Load(fResumePath, {task.first, task.last});
+    }
+    auto nInterval{static_cast<unsigned long long>(executed.size())};
+    MPI_Bcast(&nInterval,             // buffer
+              1,                      // count
+              MPI_UNSIGNED_LONG_LONG, // datatype
+              0,                      // root
+              MPI_COMM_WORLD);        // comm
+    executed.resize(nInterval);
+    MPI_Bcast(executed.data(),                 // buffer
+              static_cast<int>(2 * nInterval), // count
+              DataType<T>(),                   // datatype
+              0,                               // root
+              MPI_COMM_WORLD);                 // comm
+    return executed;
 }
 
 template<std::integral T>
@@ -191,34 +579,89 @@ auto Executor<T>::PreLoopReport() const -> void {
 template<std::integral T>
     requires(Concept::MPIPredefined<T> and sizeof(T) >= sizeof(short))
 auto Executor<T>::PostTaskReport(T iEnded) const -> void {
-    if (not fPrintProgress or fPrintProgressModulo < 0) { return; }
-    const auto [goodForEstmation, nExecutedTask]{fScheduler->NExecutedTask()};
+    // manual mode
+    if (not fPrintProgress or (iEnded + 1) % fPrintProgressModulo != 0) { return; }
+    ProgressReport(iEnded, NLocalExecutedTask(), fScheduler->NExecutedTask(), fWallTimeStopwatch.s_elapsed());
+}
+
+template<std::integral T>
+    requires(Concept::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto Executor<T>::PeriodicAction(T iEnded) -> void {
     const auto secondsElapsed{fWallTimeStopwatch.s_elapsed()};
-    const auto speed{nExecutedTask / secondsElapsed};
-    if (fPrintProgressModulo == 0) {
-        // adaptive mode, print every ~3s
-        if ((iEnded + 1) % std::max(1ll, std::llround(speed * 3)) != 0) { return; }
-    } else {
-        // manual mode
-        if ((iEnded + 1) % fPrintProgressModulo != 0) { return; }
+    // adapt number of tasks between clock checks, so that the clock is read every ~fgClockCheckPeriod
+    const auto dt{secondsElapsed - fLastClockCheckTime};
+    fLastClockCheckTime = secondsElapsed;
+    fClockCheckInterval = dt > 0 ? std::clamp(std::llround(fClockCheckInterval * fgClockCheckPeriod / dt), 1ll, 2 * fClockCheckInterval) :
+                                   2 * fClockCheckInterval;
+    fClockCheckCountdown = fClockCheckInterval;
+    MUSTARD_TRACE_COUNTER("MPIX::Executor::NLocalExecutedTask", NLocalExecutedTask());
+    // adaptive mode
+    if (fPrintProgress and fPrintProgressModulo == 0 and not fAsyncProgressReporter and
+        secondsElapsed >= fNextReportTime) {
+        fNextReportTime = secondsElapsed + fgProgressReportPeriod * Env::MPIEnv::Instance().CommWorldSize();
+        ProgressReport(iEnded, NLocalExecutedTask(), fScheduler->NExecutedTask(), secondsElapsed);
     }
+    if (fMetricsSink and secondsElapsed >= fNextMetricsTime) {
+        fNextMetricsTime = secondsElapsed + fMetricsPeriod.count();
+        MetricsSnapshot(secondsElapsed);
+    }
+    if (fCheckpoint and secondsElapsed >= fNextCheckpointTime) {
+        fNextCheckpointTime = secondsElapsed + fCheckpointPeriod.count();
+        fCheckpoint->Flush();
+    }
+}
+
+template<std::integral T>
+    requires(Concept::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto Executor<T>::AsyncReport(T nLocalExecutedTask) const -> void {
+    // called from reporter thread, where scheduler states are not accessible.
+    // global progress is extrapolated from local progress.
+    const auto size{Env::MPIEnv::Instance().CommWorldSize()};
+    const auto nExecutedTask{static_cast<T>(std::min(static_cast<long double>(nLocalExecutedTask) * size, static_cast<long double>(NTask())))};
+    ProgressReport(std::nullopt, nLocalExecutedTask, {nLocalExecutedTask > 0, nExecutedTask}, fWallTimeStopwatch.s_elapsed());
+}
+
+template<std::integral T>
+    requires(Concept::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto Executor<T>::ProgressReport(std::optional<T> iEnded, T nLocalExecutedTask, std::pair<bool, T> nExecuted, double secondsElapsed) const -> void {
+    const auto [goodForEstmation, nExecutedTask]{nExecuted};
+    const auto speed{nExecutedTask / secondsElapsed};
     const auto& mpiEnv{Env::MPIEnv::Instance()};
-    Env::Print("MPI{}> [{:%FT%T%z}] {} {} has ended\n"
+    Env::Print("MPI{}> [{:%FT%T%z}] {}\n"
                "MPI{}>   {} elaps., {}\n",
-               mpiEnv.CommWorldRank(), fmt::localtime(scsc::to_time_t(scsc::now())), fTaskName, iEnded,
+               mpiEnv.CommWorldRank(), fmt::localtime(scsc::to_time_t(scsc::now())),
+               iEnded ? fmt::format("{} {} has ended", fTaskName, *iEnded) : fmt::format("{} {}s have ended", nLocalExecutedTask, fTaskName),
                mpiEnv.CommWorldRank(), SToDHMS(secondsElapsed),
                [&, goodForEstmation{goodForEstmation}, nExecutedTask{nExecutedTask}] {
                    if (goodForEstmation) {
                        const auto eta{(NTask() - nExecutedTask) / speed};
                        const auto progress{static_cast<double>(nExecutedTask) / NTask()};
                        return fmt::format("est. rem. {} ({:.3}/s), prog.: {} | {}/{} | {:.3}%",
-                                          SToDHMS(eta), speed, NLocalExecutedTask(), nExecutedTask, NTask(), 100 * progress);
+                                          SToDHMS(eta), speed, nLocalExecutedTask, nExecutedTask, NTask(), 100 * progress);
                    } else {
-                       return fmt::format("local prog.: {}", NLocalExecutedTask());
+                       return fmt::format("local prog.: {}", nLocalExecutedTask);
                    }
                }());
 }
 
+template<std::integral T>
+    requires(Concept::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto Executor<T>::MetricsSnapshot(double wallTime) -> void {
+    const auto cpuTime{fCPUTimeStopwatch.s_used()};
+    const auto [goodForEstmation, nExecutedTask]{fScheduler->NExecutedTask()};
+    const auto speed{nExecutedTask / wallTime};
+    fMetricsSink->Write({Env::MPIEnv::Instance().CommWorldRank(),
+                         std::chrono::duration<double>{scsc::now().time_since_epoch()}.count(),
+                         static_cast<unsigned long long>(NTask()),
+                         static_cast<unsigned long long>(nExecutedTask),
+                         static_cast<unsigned long long>(NLocalExecutedTask()),
+                         speed,
+                         goodForEstmation ? std::optional{(NTask() - nExecutedTask) / speed} : std::nullopt,
+                         wallTime,
+                         cpuTime,
+                         std::max(0., wallTime - cpuTime)});
+}
+
 template<std::integral T>
     requires(Concept::MPIPredefined<T> and sizeof(T) >= sizeof(short))
 auto Executor<T>::PostLoopReport() const -> void {
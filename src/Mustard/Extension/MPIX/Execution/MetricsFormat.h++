@@ -0,0 +1,34 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+namespace Mustard::inline Extension::MPIX::inline Execution {
+
+/// File format of execution metrics exported by Executor.
+///   JSONLines:  one JSON object per line, appended at each snapshot.
+///   Prometheus: text exposition format, rewritten at each snapshot
+///               (for the node exporter textfile collector). Files of all
+///               processes and the summary file are written flat into the
+///               directory of the path.
+enum struct MetricsFormat {
+    JSONLines,
+    Prometheus
+};
+
+} // namespace Mustard::inline Extension::MPIX::inline Execution
@@ -60,6 +60,7 @@ protected:
     Task fTask;
     T fExecutingTask;
     T fNLocalExecutedTask;
+    double fSchedulingTime;
 };
 
 } // namespace Mustard::inline Extension::MPIX::inline Execution
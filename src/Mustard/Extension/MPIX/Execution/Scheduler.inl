@@ -23,6 +23,7 @@ template<std::integral T>
 auto Scheduler<T>::Reset() -> void {
     fExecutingTask = fTask.first;
     fNLocalExecutedTask = 0;
+    fSchedulingTime = 0;
 }
 
 } // namespace Mustard::inline Extension::MPIX::inline Execution
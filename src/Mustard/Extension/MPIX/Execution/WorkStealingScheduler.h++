@@ -0,0 +1,98 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Extension/MPIX/Execution/Scheduler.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PP.h++"
+#include "Mustard/Utility/NonMoveableBase.h++"
+
+#include "mpi.h"
+
+#include "muc/time"
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace Mustard::inline Extension::MPIX::inline Execution {
+
+/// Decentralized work-stealing scheduler.
+///
+/// Each rank starts with a contiguous block of tasks, published in an MPI window as a
+/// packed [begin, end) range. The owner claims batches from the front of its range,
+/// while an idle rank steals the back half of the remaining range of a randomly chosen
+/// victim. All updates are done by MPI_Compare_and_swap, so no rank acts as a master.
+/// A rank finishes once a full sweep over all ranks finds nothing left to steal.
+///
+/// Ranges are tracked in units of ceil(NTask / 2^32) tasks, so that a range fits in a
+/// single 64-bit word. For less than 2^32 tasks, a unit is exactly one task.
+template<std::integral T>
+class WorkStealingScheduler : public Scheduler<T>,
+                              public NonMoveableBase {
+public:
+    WorkStealingScheduler();
+    ~WorkStealingScheduler();
+
+private:
+    virtual auto PreLoopAction() -> void override;
+    virtual auto PreTaskAction() -> void override {}
+    virtual auto PostTaskAction() -> void override;
+    virtual auto PostLoopAction() -> void override {}
+
+    virtual auto NExecutedTask() const -> std::pair<bool, T> override;
+
+private:
+    using Word = std::uint64_t;
+
+    struct Range {
+        std::uint32_t begin;
+        std::uint32_t end;
+    };
+
+    static auto Pack(Range range) -> Word { return static_cast<Word>(range.begin) << 32 | range.end; }
+    static auto Unpack(Word word) -> Range { return {static_cast<std::uint32_t>(word >> 32), static_cast<std::uint32_t>(word)}; }
+
+    auto UnitToTask(std::uint64_t unit) const -> T;
+    auto CompareAndSwap(int rank, Word expected, Word desired) -> Word;
+    auto Fetch(int rank) -> Word;
+    auto ClaimLocal() -> bool;
+    auto Steal() -> bool;
+    auto Publish(Range range) -> void;
+
+private:
+    const int fRank;
+    const int fSize;
+    MPI_Win fWindow;
+
+    std::uint64_t fUnitSize;
+    std::uint64_t fNUnit;
+    std::uint32_t fBatchSize;
+    Word fLocalWord;
+    T fBatchEnd;
+    Math::Random::Xoshiro256PP fRandom;
+
+    static constexpr auto fgBalancingFactor{0.001};
+};
+
+} // namespace Mustard::inline Extension::MPIX::inline Execution
+
+#include "Mustard/Extension/MPIX/Execution/WorkStealingScheduler.inl"
@@ -0,0 +1,186 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::inline Extension::MPIX::inline Execution {
+
+template<std::integral T>
+WorkStealingScheduler<T>::WorkStealingScheduler() :
+    Scheduler<T>{},
+    NonMoveableBase{},
+    fRank{Env::MPIEnv::Instance().CommWorldRank()},
+    fSize{Env::MPIEnv::Instance().CommWorldSize()},
+    fWindow{
+        [] {
+            void* base;
+            MPI_Win window;
+            MPI_Win_allocate(sizeof(Word),   // size
+                             sizeof(Word),   // disp_unit
+                             MPI_INFO_NULL,  // info
+                             MPI_COMM_WORLD, // comm
+                             &base,          // baseptr
+                             &window);       // win
+            // window memory is uninitialized, start from an empty range
+            *static_cast<Word*>(base) = 0;
+            return window;
+        }()},
+    fUnitSize{},
+    fNUnit{},
+    fBatchSize{},
+    fLocalWord{},
+    fBatchEnd{},
+    fRandom{static_cast<Math::Random::Xoshiro256PP::SeedType>(fRank)} {
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, // assert
+                     fWindow);         // win
+    // no RMA before all windows are initialized
+    MPI_Barrier(MPI_COMM_WORLD);
+}
+
+template<std::integral T>
+WorkStealingScheduler<T>::~WorkStealingScheduler() {
+    MPI_Win_unlock_all(fWindow);
+    MPI_Win_free(&fWindow);
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::PreLoopAction() -> void {
+    const auto nTask{static_cast<std::uint64_t>(this->NTask())};
+    fUnitSize = nTask / std::numeric_limits<std::uint32_t>::max() + 1;
+    fNUnit = (nTask + fUnitSize - 1) / fUnitSize;
+    // width ~ BalanceFactor -> +/- BalanceFactor / 2
+    fBatchSize = static_cast<std::uint32_t>(fgBalancingFactor / 2 * static_cast<double>(fNUnit) / fSize) + 1;
+    // Nobody steals before the barrier following PreLoopAction, so the initial block is always claimable
+    fLocalWord = Fetch(fRank);
+    Publish({static_cast<std::uint32_t>(fNUnit * fRank / fSize),
+             static_cast<std::uint32_t>(fNUnit * (fRank + 1) / fSize)});
+    // with fewer task units than processes, the initial block can be empty
+    if (not ClaimLocal()) { this->fExecutingTask = this->fTask.last; }
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::PostTaskAction() -> void {
+    if (++this->fExecutingTask != fBatchEnd) { return; }
+    const muc::wall_time_stopwatch<> schedulingStopwatch;
+    const auto claimed{ClaimLocal() or Steal()};
+    this->fSchedulingTime += schedulingStopwatch.s_elapsed();
+    if (claimed) { return; }
+    this->fExecutingTask = this->fTask.last;
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::NExecutedTask() const -> std::pair<bool, T> {
+    // Extrapolate local progress to all processes, since load is balanced
+    const auto nExecutedTask{std::min(static_cast<std::uint64_t>(this->fNLocalExecutedTask) * fSize,
+                                      static_cast<std::uint64_t>(this->NTask()))};
+    return {static_cast<std::uint64_t>(this->fNLocalExecutedTask) > 10 * fBatchSize * fUnitSize,
+            static_cast<T>(nExecutedTask)};
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::UnitToTask(std::uint64_t unit) const -> T {
+    if (unit >= fNUnit) { return this->fTask.last; }
+    return this->fTask.first + static_cast<T>(unit * fUnitSize);
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::CompareAndSwap(int rank, Word expected, Word desired) -> Word {
+    Word previous;
+    MPI_Compare_and_swap(&desired,     // origin_addr
+                         &expected,    // compare_addr
+                         &previous,    // result_addr
+                         MPI_UINT64_T, // datatype
+                         rank,         // target_rank
+                         0,            // target_disp
+                         fWindow);     // win
+    MPI_Win_flush(rank,                // rank
+                  fWindow);            // win
+    return previous;
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::Fetch(int rank) -> Word {
+    Word word;
+    MPI_Fetch_and_op(nullptr,      // origin_addr
+                     &word,        // result_addr
+                     MPI_UINT64_T, // datatype
+                     rank,         // target_rank
+                     0,            // target_disp
+                     MPI_NO_OP,    // op
+                     fWindow);     // win
+    MPI_Win_flush(rank,            // rank
+                  fWindow);        // win
+    return word;
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::ClaimLocal() -> bool {
+    while (true) {
+        const auto [begin, end]{Unpack(fLocalWord)};
+        if (begin == end) { return false; }
+        const auto batchEnd{begin + std::min(fBatchSize, end - begin)};
+        const auto desired{Pack({batchEnd, end})};
+        const auto previous{CompareAndSwap(fRank, fLocalWord, desired)};
+        if (previous == fLocalWord) {
+            fLocalWord = desired;
+            this->fExecutingTask = UnitToTask(begin);
+            fBatchEnd = UnitToTask(batchEnd);
+            return true;
+        }
+        // a thief has shortened the range, retry with what is left
+        fLocalWord = previous;
+    }
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::Steal() -> bool {
+    if (fSize == 1) { return false; }
+    // Sweep all other ranks, starting from a random victim
+    const auto offset{static_cast<int>(fRandom() % (fSize - 1))};
+    for (int i{}; i < fSize - 1; ++i) {
+        const auto victim{(fRank + 1 + (offset + i) % (fSize - 1)) % fSize};
+        auto expected{Fetch(victim)};
+        while (true) {
+            const auto [begin, end]{Unpack(expected)};
+            if (begin == end) { break; }
+            // steal the back half, rounded up
+            const auto mid{end - (end - begin + 1) / 2};
+            const auto previous{CompareAndSwap(victim, expected, Pack({begin, mid}))};
+            if (previous == expected) {
+                const auto batchEnd{mid + std::min(fBatchSize, end - mid)};
+                Publish({batchEnd, end});
+                this->fExecutingTask = UnitToTask(mid);
+                fBatchEnd = UnitToTask(batchEnd);
+                return true;
+            }
+            expected = previous;
+        }
+    }
+    return false;
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::Publish(Range range) -> void {
+    // Thieves leave an empty range untouched, so this normally succeeds at first try
+    const auto desired{Pack(range)};
+    Word previous;
+    while ((previous = CompareAndSwap(fRank, fLocalWord, desired)) != fLocalWord) {
+        fLocalWord = previous;
+    }
+    fLocalWord = desired;
+}
+
+} // namespace Mustard::inline Extension::MPIX::inline Execution
@@ -0,0 +1,53 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Utility/NonMoveableBase.h++"
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+namespace Mustard::inline Extension::MPIX::inline Execution::internal {
+
+/// Calls Report(n) periodically in a background thread, where n is the latest value passed
+/// to Publish(). Publish() is a relaxed atomic store, so the publishing loop is not slowed down.
+template<std::integral T>
+class AsyncProgressReporter final : public NonMoveableBase {
+public:
+    AsyncProgressReporter(std::chrono::duration<double> delay, std::chrono::duration<double> period,
+                          std::function<auto(T)->void> Report);
+
+    auto Publish(T n) -> void { fNLocalExecutedTask.store(n, std::memory_order::relaxed); }
+
+private:
+    std::atomic<T> fNLocalExecutedTask;
+    std::mutex fMutex;
+    std::condition_variable_any fCondition;
+    std::jthread fReporterThread;
+};
+
+} // namespace Mustard::inline Extension::MPIX::inline Execution::internal
+
+#include "Mustard/Extension/MPIX/Execution/internal/AsyncProgressReporter.inl"
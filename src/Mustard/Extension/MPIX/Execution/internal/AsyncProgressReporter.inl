@@ -0,0 +1,42 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::inline Extension::MPIX::inline Execution::internal {
+
+template<std::integral T>
+AsyncProgressReporter<T>::AsyncProgressReporter(std::chrono::duration<double> delay, std::chrono::duration<double> period,
+                                                std::function<auto(T)->void> Report) :
+    NonMoveableBase{},
+    fNLocalExecutedTask{},
+    fMutex{},
+    fCondition{},
+    fReporterThread{
+        [this, delay, period, Report{std::move(Report)}](std::stop_token stop) {
+            using namespace std::chrono;
+            auto next{steady_clock::now() + duration_cast<steady_clock::duration>(delay)};
+            std::unique_lock lock{fMutex};
+            while (true) {
+                // woken up by timeout or by stop request from jthread destructor
+                fCondition.wait_until(lock, stop, next, [] { return false; });
+                if (stop.stop_requested()) { break; }
+                Report(fNLocalExecutedTask.load(std::memory_order::relaxed));
+                next += duration_cast<steady_clock::duration>(period);
+            }
+        }} {}
+
+} // namespace Mustard::inline Extension::MPIX::inline Execution::internal
@@ -0,0 +1,235 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Extension/MPIX/Execution/internal/MetricsSink.h++"
+#include "Mustard/Extension/MPIX/ParallelizePath.h++"
+#include "Mustard/Utility/PrettyLog.h++"
+
+#include "muc/utility"
+
+#include "fmt/format.h"
+
+#include <cmath>
+#include <stdexcept>
+#include <system_error>
+
+namespace Mustard::inline Extension::MPIX::inline Execution::internal {
+
+namespace {
+
+auto JSONNumber(double x) -> std::string {
+    return std::isfinite(x) ? fmt::format("{}", x) : "null";
+}
+
+// the textfile collector reads one flat directory, so files of all processes go next to path
+auto FlatPath(const std::filesystem::path& path, std::string_view suffix) -> std::filesystem::path {
+    auto flat{path};
+    return flat.replace_filename(path.stem().concat(suffix)).replace_extension(path.extension());
+}
+
+} // namespace
+
+MetricsSink::MetricsSink(const std::filesystem::path& path, MetricsFormat format, std::string_view execution) :
+    NonMoveableBase{},
+    fPath{},
+    fSummaryPath{},
+    fFormat{format},
+    fExecution{execution},
+    fFile{} {
+    switch (fFormat) {
+    case MetricsFormat::JSONLines:
+        fPath = ParallelizePath(path);
+        fSummaryPath = fPath;
+        fFile = std::fopen(fPath.generic_string().c_str(), "a");
+        if (fFile == nullptr) {
+            throw std::runtime_error{PrettyException(fmt::format("Cannot open metrics file '{}'", fPath.generic_string()))};
+        }
+        break;
+    case MetricsFormat::Prometheus: {
+        const auto& mpiEnv{Env::MPIEnv::Instance()};
+        fPath = mpiEnv.Parallel() ? FlatPath(path, fmt::format("_mpi{}", mpiEnv.CommWorldRank())) : path;
+        fSummaryPath = FlatPath(path, "_summary");
+        if (fPath.has_parent_path()) {
+            std::error_code muteError; // created by another process
+            std::filesystem::create_directories(fPath.parent_path(), muteError);
+        }
+    } break;
+    default:
+        muc::unreachable();
+    }
+}
+
+MetricsSink::~MetricsSink() {
+    if (fFile) { std::fclose(fFile); }
+}
+
+auto MetricsSink::Write(const Snapshot& snapshot) -> void {
+    switch (fFormat) {
+    case MetricsFormat::JSONLines:
+        Publish(fPath, fmt::format(R"({{"type":"snapshot","execution":"{}","rank":{},"timestamp":{:.3f},)"
+                            R"("n_task":{},"n_executed_task":{},"n_local_executed_task":{},"task_rate":{},"eta":{},)"
+                            R"("wall_time":{:.6f},"cpu_time":{:.6f},"idle_time":{:.6f}}})"
+                            "\n",
+                            EscapeJSON(fExecution), snapshot.rank, snapshot.timestamp,
+                            snapshot.nTask, snapshot.nExecutedTask, snapshot.nLocalExecutedTask,
+                            JSONNumber(snapshot.taskRate), snapshot.eta ? JSONNumber(*snapshot.eta) : "null",
+                            snapshot.wallTime, snapshot.cpuTime, snapshot.idleTime));
+        break;
+    case MetricsFormat::Prometheus: {
+        const auto label{fmt::format(R"(execution="{}",rank="{}")", EscapeLabel(fExecution), snapshot.rank)};
+        std::string text;
+        const auto Gauge{[&](std::string_view name, std::string_view help, auto value) {
+            text += fmt::format("# HELP {0} {1}\n"
+                                "# TYPE {0} gauge\n"
+                                "{0}{{{2}}} {3}\n",
+                                name, help, label, value);
+        }};
+        Gauge("mustard_executor_timestamp_seconds", "Time of the snapshot.", fmt::format("{:.3f}", snapshot.timestamp));
+        Gauge("mustard_executor_tasks", "Number of tasks of the execution.", snapshot.nTask);
+        Gauge("mustard_executor_executed_tasks", "Number of tasks executed by all processes (may be estimated).", snapshot.nExecutedTask);
+        Gauge("mustard_executor_local_executed_tasks", "Number of tasks executed by this process.", snapshot.nLocalExecutedTask);
+        Gauge("mustard_executor_task_rate", "Tasks executed per second.", snapshot.taskRate);
+        if (snapshot.eta) { Gauge("mustard_executor_eta_seconds", "Estimated remaining time.", *snapshot.eta); }
+        Gauge("mustard_executor_wall_time_seconds", "Wall time elapsed.", snapshot.wallTime);
+        Gauge("mustard_executor_cpu_time_seconds", "CPU time used.", snapshot.cpuTime);
+        Gauge("mustard_executor_idle_time_seconds", "Wall time not spent on CPU.", snapshot.idleTime);
+        Publish(fPath, text);
+    } break;
+    default:
+        muc::unreachable();
+    }
+}
+
+auto MetricsSink::WriteSummary(double timestamp, unsigned long long nTask, const std::vector<RankSummary>& summary) -> void {
+    switch (fFormat) {
+    case MetricsFormat::JSONLines: {
+        std::string rank;
+        for (auto&& s : summary) {
+            rank += fmt::format(R"({}{{"rank":{},"n_local_executed_task":{},"wall_time":{:.6f},"cpu_time":{:.6f},"idle_time":{:.6f}}})",
+                                rank.empty() ? "" : ",", s.rank, s.nLocalExecutedTask, s.wallTime, s.cpuTime, s.idleTime);
+        }
+        Publish(fSummaryPath, fmt::format(R"({{"type":"summary","execution":"{}","timestamp":{:.3f},"n_task":{},"rank":[{}]}})"
+                            "\n",
+                            EscapeJSON(fExecution), timestamp, nTask, rank));
+    } break;
+    case MetricsFormat::Prometheus: {
+        const auto execution{EscapeLabel(fExecution)};
+        std::string text;
+        const auto Gauge{[&](std::string_view name, std::string_view help, auto&& Value) {
+            text += fmt::format("# HELP {0} {1}\n"
+                                "# TYPE {0} gauge\n",
+                                name, help);
+            for (auto&& s : summary) {
+                text += fmt::format(R"({}{{execution="{}",rank="{}"}} {})"
+                                    "\n",
+                                    name, execution, s.rank, Value(s));
+            }
+        }};
+        // in its own file, with series not colliding with those of per-process files
+        text += fmt::format("# HELP mustard_executor_summary_finished_timestamp_seconds Time of the end of the execution.\n"
+                            "# TYPE mustard_executor_summary_finished_timestamp_seconds gauge\n"
+                            "mustard_executor_summary_finished_timestamp_seconds{{execution=\"{}\"}} {:.3f}\n"
+                            "# HELP mustard_executor_summary_tasks Number of tasks of the execution.\n"
+                            "# TYPE mustard_executor_summary_tasks gauge\n"
+                            "mustard_executor_summary_tasks{{execution=\"{}\"}} {}\n",
+                            execution, timestamp, execution, nTask);
+        Gauge("mustard_executor_summary_local_executed_tasks", "Number of tasks executed by the process.", [](auto&& s) { return s.nLocalExecutedTask; });
+        Gauge("mustard_executor_summary_wall_time_seconds", "Wall time elapsed.", [](auto&& s) { return s.wallTime; });
+        Gauge("mustard_executor_summary_cpu_time_seconds", "CPU time used.", [](auto&& s) { return s.cpuTime; });
+        Gauge("mustard_executor_summary_idle_time_seconds", "Wall time not spent on CPU.", [](auto&& s) { return s.idleTime; });
+        Publish(fSummaryPath, text);
+    } break;
+    default:
+        muc::unreachable();
+    }
+}
+
+auto MetricsSink::Publish(const std::filesystem::path& path, const std::string& text) -> void {
+    switch (fFormat) {
+    case MetricsFormat::JSONLines:
+        std::fputs(text.c_str(), fFile);
+        std::fflush(fFile);
+        break;
+    case MetricsFormat::Prometheus: {
+        // write then rename, so that collectors never read a partial file
+        auto temporaryPath{path};
+        temporaryPath.concat(".tmp");
+        const auto file{std::fopen(temporaryPath.generic_string().c_str(), "w")};
+        if (file == nullptr) {
+            throw std::runtime_error{PrettyException(fmt::format("Cannot open metrics file '{}'", temporaryPath.generic_string()))};
+        }
+        std::fputs(text.c_str(), file);
+        std::fclose(file);
+        std::filesystem::rename(temporaryPath, path);
+    } break;
+    default:
+        muc::unreachable();
+    }
+}
+
+auto MetricsSink::EscapeJSON(std::string_view s) -> std::string {
+    std::string escaped;
+    escaped.reserve(s.size());
+    for (auto&& c : s) {
+        switch (c) {
+        case '"':
+            escaped += R"(\")";
+            break;
+        case '\\':
+            escaped += R"(\\)";
+            break;
+        case '\n':
+            escaped += R"(\n)";
+            break;
+        case '\t':
+            escaped += R"(\t)";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                escaped += fmt::format(R"(\u{:04x})", static_cast<int>(c));
+            } else {
+                escaped += c;
+            }
+        }
+    }
+    return escaped;
+}
+
+auto MetricsSink::EscapeLabel(std::string_view s) -> std::string {
+    std::string escaped;
+    escaped.reserve(s.size());
+    for (auto&& c : s) {
+        switch (c) {
+        case '"':
+            escaped += R"(\")";
+            break;
+        case '\\':
+            escaped += R"(\\)";
+            break;
+        case '\n':
+            escaped += R"(\n)";
+            break;
+        default:
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+} // namespace Mustard::inline Extension::MPIX::inline Execution::internal
@@ -0,0 +1,81 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Extension/MPIX/Execution/MetricsFormat.h++"
+#include "Mustard/Utility/NonMoveableBase.h++"
+
+#include <cstdio>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Mustard::inline Extension::MPIX::inline Execution::internal {
+
+/// Writes execution metrics of one process to a file, see MetricsFormat.
+/// JSON lines go to the parallelized path (see ParallelizePath), summary appended to that of rank 0.
+/// Prometheus files go flat next to path (<stem>_mpi<rank>.prom), as the textfile collector does
+/// not search subdirectories, and the summary goes to <stem>_summary.prom.
+class MetricsSink final : public NonMoveableBase {
+public:
+    struct Snapshot {
+        int rank;
+        double timestamp;
+        unsigned long long nTask;
+        unsigned long long nExecutedTask;
+        unsigned long long nLocalExecutedTask;
+        double taskRate;
+        std::optional<double> eta;
+        double wallTime;
+        double cpuTime;
+        double idleTime;
+    };
+
+    struct RankSummary {
+        int rank;
+        unsigned long long nLocalExecutedTask;
+        double wallTime;
+        double cpuTime;
+        double idleTime;
+    };
+
+public:
+    MetricsSink(const std::filesystem::path& path, MetricsFormat format, std::string_view execution);
+    ~MetricsSink();
+
+    auto Write(const Snapshot& snapshot) -> void;
+    auto WriteSummary(double timestamp, unsigned long long nTask, const std::vector<RankSummary>& summary) -> void;
+
+private:
+    auto Publish(const std::filesystem::path& path, const std::string& text) -> void;
+
+    static auto EscapeJSON(std::string_view s) -> std::string;
+    static auto EscapeLabel(std::string_view s) -> std::string;
+
+private:
+    std::filesystem::path fPath;
+    std::filesystem::path fSummaryPath;
+    MetricsFormat fFormat;
+    std::string fExecution;
+    std::FILE* fFile;
+};
+
+} // namespace Mustard::inline Extension::MPIX::inline Execution::internal
@@ -0,0 +1,87 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Env/Logging.h++"
+#include "Mustard/Extension/MPIX/Execution/internal/TaskIndexMap.h++"
+#include "Mustard/Utility/NonMoveableBase.h++"
+#include "Mustard/Utility/PrettyLog.h++"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <concepts>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Mustard::inline Extension::MPIX::inline Execution::internal {
+
+/// Append-only record of executed tasks of one process.
+///
+/// Executed task IDs are compressed into arithmetic progressions (begin, stride, count),
+/// so both contiguous chunks (dynamic scheduling) and strided sequences (static
+/// scheduling) cost one line per flush. File format (text):
+///
+///   task <first> <last>
+///   <begin> <stride> <count>
+///   ...
+///
+/// A truncated last line (e.g. killed while writing) either fails to parse or
+/// under-reports its count, so the loaded record never claims unexecuted tasks.
+/// Records are kept in memory until Flush() (called periodically by Executor).
+template<std::integral T>
+class TaskCheckpoint final : public NonMoveableBase {
+public:
+    using Interval = typename TaskIndexMap<T>::Interval;
+
+public:
+    TaskCheckpoint(const std::filesystem::path& path, Interval task);
+    ~TaskCheckpoint();
+
+    auto Record(T taskID) -> void;
+    auto Record(Interval executed) -> void;
+    auto Flush() -> void;
+
+    /// Load executed tasks of all processes from checkpoint files written with (the
+    /// parallelized form of) path. Returns sorted and merged intervals.
+    static auto Load(const std::filesystem::path& path, Interval task) -> std::vector<Interval>;
+
+private:
+    struct Progression {
+        T begin;
+        T stride;
+        T count;
+    };
+
+private:
+    std::FILE* fFile;
+    Progression fCurrent;
+    std::vector<Progression> fPending;
+};
+
+} // namespace Mustard::inline Extension::MPIX::inline Execution::internal
+
+#include "Mustard/Extension/MPIX/Execution/internal/TaskCheckpoint.inl"
@@ -0,0 +1,145 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::inline Extension::MPIX::inline Execution::internal {
+
+template<std::integral T>
+TaskCheckpoint<T>::TaskCheckpoint(const std::filesystem::path& path, Interval task) :
+    NonMoveableBase{},
+    fFile{std::fopen(path.generic_string().c_str(), "w")},
+    fCurrent{},
+    fPending{} {
+    if (fFile == nullptr) {
+        throw std::runtime_error{PrettyException(fmt::format("Cannot open checkpoint file '{}'", path.generic_string()))};
+    }
+    fmt::print(fFile, "task {} {}\n", task.first, task.last);
+    std::fflush(fFile);
+}
+
+template<std::integral T>
+TaskCheckpoint<T>::~TaskCheckpoint() {
+    Flush();
+    std::fclose(fFile);
+}
+
+template<std::integral T>
+auto TaskCheckpoint<T>::Record(T taskID) -> void {
+    if (fCurrent.count == 0) {
+        fCurrent = {taskID, 1, 1};
+    } else if (fCurrent.count == 1 and taskID > fCurrent.begin) {
+        fCurrent.stride = taskID - fCurrent.begin;
+        fCurrent.count = 2;
+    } else if (taskID == fCurrent.begin + fCurrent.stride * fCurrent.count) {
+        ++fCurrent.count;
+    } else {
+        fPending.push_back(fCurrent);
+        fCurrent = {taskID, 1, 1};
+    }
+}
+
+template<std::integral T>
+auto TaskCheckpoint<T>::Record(Interval executed) -> void {
+    if (executed.last <= executed.first) { return; }
+    fPending.push_back({executed.first, 1, static_cast<T>(executed.last - executed.first)});
+}
+
+template<std::integral T>
+auto TaskCheckpoint<T>::Flush() -> void {
+    if (fCurrent.count != 0) {
+        fPending.push_back(fCurrent);
+        fCurrent = {};
+    }
+    for (auto&& [begin, stride, count] : fPending) {
+        fmt::print(fFile, "{} {} {}\n", begin, stride, count);
+    }
+    std::fflush(fFile);
+    fPending.clear();
+}
+
+template<std::integral T>
+auto TaskCheckpoint<T>::Load(const std::filesystem::path& path, Interval task) -> std::vector<Interval> {
+    std::vector<std::filesystem::path> fileList;
+    if (std::filesystem::is_regular_file(path)) {
+        fileList.emplace_back(path);
+    }
+    // see ParallelizePath for the layout of checkpoint files of parallel processes
+    if (const auto directory{std::filesystem::path{path}.replace_extension()};
+        std::filesystem::is_directory(directory)) {
+        const auto prefix{path.stem().generic_string() + "_mpi"};
+        for (auto&& entry : std::filesystem::recursive_directory_iterator{directory}) {
+            if (entry.is_regular_file() and
+                entry.path().extension() == path.extension() and
+                entry.path().filename().generic_string().starts_with(prefix)) {
+                fileList.emplace_back(entry.path());
+            }
+        }
+    }
+    if (fileList.empty()) {
+        Env::PrintPrettyWarning(fmt::format("No checkpoint found at '{}', all tasks will be executed", path.generic_string()));
+        return {};
+    }
+
+    std::vector<Progression> progression;
+    for (auto&& file : fileList) {
+        std::ifstream is{file};
+        std::string line;
+        std::getline(is, line);
+        std::string keyword;
+        long long first{-1};
+        long long last{-1};
+        std::istringstream{line} >> keyword >> first >> last;
+        if (keyword != "task" or first != static_cast<long long>(task.first) or last != static_cast<long long>(task.last)) {
+            Env::PrintPrettyWarning(fmt::format("Checkpoint file '{}' does not match task [{}, {}), ignored",
+                                                file.generic_string(), task.first, task.last));
+            continue;
+        }
+        while (std::getline(is, line)) {
+            long long begin;
+            long long stride;
+            long long count;
+            if (not(std::istringstream{line} >> begin >> stride >> count)) { continue; }
+            if (begin < first or stride < 1 or count < 1 or
+                begin + stride * (count - 1) >= last) { continue; }
+            progression.push_back({static_cast<T>(begin), static_cast<T>(stride), static_cast<T>(count)});
+        }
+    }
+
+    // k-way merge of progressions into intervals, with O(number of progressions) memory
+    const auto later{[](const Progression& a, const Progression& b) { return a.begin > b.begin; }};
+    std::priority_queue<Progression, std::vector<Progression>, decltype(later)> queue{later, std::move(progression)};
+    std::vector<Interval> executed;
+    while (not queue.empty()) {
+        auto p{queue.top()};
+        queue.pop();
+        const auto contiguous{p.stride == 1 or p.count == 1};
+        const Interval interval{p.begin, static_cast<T>(p.begin + (contiguous ? p.count : 1))};
+        if (executed.empty() or executed.back().last < interval.first) {
+            executed.push_back(interval);
+        } else {
+            executed.back().last = std::max(executed.back().last, interval.last);
+        }
+        if (not contiguous) {
+            p.begin += p.stride;
+            --p.count;
+            queue.push(p);
+        }
+    }
+    return executed;
+}
+
+} // namespace Mustard::inline Extension::MPIX::inline Execution::internal
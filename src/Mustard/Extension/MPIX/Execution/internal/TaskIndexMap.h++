@@ -0,0 +1,58 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Utility/PrettyLog.h++"
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <stdexcept>
+#include <vector>
+
+namespace Mustard::inline Extension::MPIX::inline Execution::internal {
+
+/// Maps a compact index range [0, Size()) onto a sorted set of disjoint task intervals,
+/// so that schedulers can distribute a sparse task set as contiguous slices.
+template<std::integral T>
+class TaskIndexMap {
+public:
+    struct Interval {
+        T first;
+        T last;
+    };
+
+public:
+    TaskIndexMap();
+    explicit TaskIndexMap(std::vector<Interval> interval);
+
+    auto Empty() const -> bool { return fInterval.empty(); }
+    auto Size() const -> T { return fOffset.back(); }
+    auto Intervals() const -> const auto& { return fInterval; }
+
+    auto operator[](T i) const -> T;
+
+private:
+    std::vector<Interval> fInterval;
+    std::vector<T> fOffset;
+};
+
+} // namespace Mustard::inline Extension::MPIX::inline Execution::internal
+
+#include "Mustard/Extension/MPIX/Execution/internal/TaskIndexMap.inl"
@@ -0,0 +1,50 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::inline Extension::MPIX::inline Execution::internal {
+
+template<std::integral T>
+TaskIndexMap<T>::TaskIndexMap() :
+    fInterval{},
+    fOffset{0} {}
+
+template<std::integral T>
+TaskIndexMap<T>::TaskIndexMap(std::vector<Interval> interval) :
+    fInterval{},
+    fOffset{0} {
+    fInterval.reserve(interval.size());
+    fOffset.reserve(interval.size() + 1);
+    for (auto&& [first, last] : interval) {
+        if (last < first) { throw std::invalid_argument{PrettyException("Interval with last < first")}; }
+        if (last == first) { continue; }
+        if (not fInterval.empty() and first < fInterval.back().last) {
+            throw std::invalid_argument{PrettyException("Intervals are not sorted or overlapped")};
+        }
+        fInterval.push_back({first, last});
+        fOffset.push_back(fOffset.back() + (last - first));
+    }
+}
+
+template<std::integral T>
+auto TaskIndexMap<T>::operator[](T i) const -> T {
+    assert(i < Size());
+    const auto k{std::ranges::upper_bound(fOffset, i) - fOffset.cbegin() - 1};
+    return fInterval[k].first + (i - fOffset[k]);
+}
+
+} // namespace Mustard::inline Extension::MPIX::inline Execution::internal
@@ -0,0 +1,89 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Extension/MPIX/DataType.h++"
+
+#include "mpi.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace Mustard::inline Extension::MPIX::inline Execution::internal {
+
+/// Per-task execution time profiler.
+///
+/// Task times are recorded in a log-bucketed histogram (16 linear sub-buckets per power
+/// of 2 nanoseconds, i.e. < 6.25% relative bucket width), along with the N slowest tasks.
+/// Recording is O(1) apart from the rare heap update of slow tasks. Merge() collects the
+/// results of all processes on the master.
+template<std::integral T>
+class TaskProfiler {
+public:
+    struct SlowTask {
+        double time;
+        T task;
+        int rank;
+    };
+
+public:
+    explicit TaskProfiler(int nSlowest);
+
+    auto Record(T task, std::chrono::nanoseconds time) -> void;
+    auto Merge() -> void;
+
+    auto NTask() const -> auto { return fNTask; }
+    auto MeanTime() const -> double { return fTotalTime / fNTask; }
+    auto MinTime() const -> auto { return fMinTime; }
+    auto MaxTime() const -> auto { return fMaxTime; }
+    auto Percentile(double q) const -> double;
+    auto Slowest() const -> const auto& { return fSlowest; }
+
+private:
+    static auto BucketIndex(std::uint64_t ns) -> int;
+    static auto BucketLowerBound(int i) -> std::uint64_t;
+
+private:
+    static constexpr auto fgNSubBucketBit{4};
+    static constexpr auto fgNSubBucket{1 << fgNSubBucketBit};
+    static constexpr auto fgNLinear{2 * fgNSubBucket};
+    static constexpr auto fgNBucket{fgNLinear + (64 - fgNSubBucketBit - 1) * fgNSubBucket};
+
+private:
+    int fNSlowest;
+    std::array<unsigned long long, fgNBucket> fHistogram;
+    unsigned long long fNTask;
+    double fTotalTime;
+    double fMinTime;
+    double fMaxTime;
+    std::vector<SlowTask> fSlowest;
+};
+
+} // namespace Mustard::inline Extension::MPIX::inline Execution::internal
+
+#include "Mustard/Extension/MPIX/Execution/internal/TaskProfiler.inl"
@@ -0,0 +1,143 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::inline Extension::MPIX::inline Execution::internal {
+
+template<std::integral T>
+TaskProfiler<T>::TaskProfiler(int nSlowest) :
+    fNSlowest{std::max(0, nSlowest)},
+    fHistogram{},
+    fNTask{},
+    fTotalTime{},
+    fMinTime{std::numeric_limits<double>::max()},
+    fMaxTime{},
+    fSlowest{} {
+    fSlowest.reserve(fNSlowest);
+}
+
+template<std::integral T>
+auto TaskProfiler<T>::Record(T task, std::chrono::nanoseconds time) -> void {
+    const auto ns{static_cast<std::uint64_t>(std::max<std::chrono::nanoseconds::rep>(0, time.count()))};
+    const auto s{ns * 1e-9};
+    ++fHistogram[BucketIndex(ns)];
+    ++fNTask;
+    fTotalTime += s;
+    fMinTime = std::min(fMinTime, s);
+    fMaxTime = std::max(fMaxTime, s);
+    // min-heap of the slowest tasks
+    const auto Slower{[](auto&& a, auto&& b) { return a.time > b.time; }};
+    if (std::ssize(fSlowest) < fNSlowest) {
+        fSlowest.push_back({s, task, Env::MPIEnv::Instance().CommWorldRank()});
+        std::ranges::push_heap(fSlowest, Slower);
+    } else if (fNSlowest > 0 and s > fSlowest.front().time) {
+        std::ranges::pop_heap(fSlowest, Slower);
+        fSlowest.back() = {s, task, Env::MPIEnv::Instance().CommWorldRank()};
+        std::ranges::push_heap(fSlowest, Slower);
+    }
+}
+
+template<std::integral T>
+auto TaskProfiler<T>::Merge() -> void {
+    const auto& mpiEnv{Env::MPIEnv::Instance()};
+    const auto master{mpiEnv.OnCommWorldMaster()};
+    const auto Reduce{[&](auto* data, int count, MPI_Datatype type, MPI_Op op) {
+        MPI_Reduce(master ? MPI_IN_PLACE : data, // sendbuf
+                   master ? data : nullptr,      // recvbuf
+                   count,                        // count
+                   type,                         // datatype
+                   op,                           // op
+                   0,                            // root
+                   MPI_COMM_WORLD);              // comm
+    }};
+    Reduce(fHistogram.data(), fgNBucket, MPI_UNSIGNED_LONG_LONG, MPI_SUM);
+    Reduce(&fNTask, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM);
+    Reduce(&fTotalTime, 1, MPI_DOUBLE, MPI_SUM);
+    Reduce(&fMinTime, 1, MPI_DOUBLE, MPI_MIN);
+    Reduce(&fMaxTime, 1, MPI_DOUBLE, MPI_MAX);
+
+    if (fNSlowest == 0) { return; }
+    std::vector<double> time(fNSlowest, -1);
+    std::vector<T> task(fNSlowest);
+    for (int i{}; i < std::ssize(fSlowest); ++i) {
+        time[i] = fSlowest[i].time;
+        task[i] = fSlowest[i].task;
+    }
+    std::vector<double> allTime;
+    std::vector<T> allTask;
+    if (master) {
+        allTime.resize(fNSlowest * mpiEnv.CommWorldSize());
+        allTask.resize(fNSlowest * mpiEnv.CommWorldSize());
+    }
+    MPI_Gather(time.data(),     // sendbuf
+               fNSlowest,       // sendcount
+               MPI_DOUBLE,      // sendtype
+               allTime.data(),  // recvbuf
+               fNSlowest,       // recvcount
+               MPI_DOUBLE,      // recvtype
+               0,               // root
+               MPI_COMM_WORLD); // comm
+    MPI_Gather(task.data(),     // sendbuf
+               fNSlowest,       // sendcount
+               DataType<T>(),   // sendtype
+               allTask.data(),  // recvbuf
+               fNSlowest,       // recvcount
+               DataType<T>(),   // recvtype
+               0,               // root
+               MPI_COMM_WORLD); // comm
+    if (not master) { return; }
+    fSlowest.clear();
+    for (int i{}; i < std::ssize(allTime); ++i) {
+        if (allTime[i] < 0) { continue; }
+        fSlowest.push_back({allTime[i], allTask[i], static_cast<int>(i / fNSlowest)});
+    }
+    std::ranges::sort(fSlowest, std::greater{}, &SlowTask::time);
+    if (std::ssize(fSlowest) > fNSlowest) { fSlowest.resize(fNSlowest); }
+}
+
+template<std::integral T>
+auto TaskProfiler<T>::Percentile(double q) const -> double {
+    if (fNTask == 0) { return 0; }
+    const auto rank{std::clamp(static_cast<unsigned long long>(std::ceil(q * fNTask)), 1ull, fNTask)};
+    unsigned long long count{};
+    for (int i{}; i < fgNBucket; ++i) {
+        count += fHistogram[i];
+        if (count < rank) { continue; }
+        const auto lower{BucketLowerBound(i)};
+        const auto width{i < fgNLinear ? 1 : std::uint64_t{1} << ((i - fgNLinear) / fgNSubBucket + 1)};
+        return std::clamp((lower + 0.5 * width) * 1e-9, fMinTime, fMaxTime);
+    }
+    return fMaxTime;
+}
+
+template<std::integral T>
+auto TaskProfiler<T>::BucketIndex(std::uint64_t ns) -> int {
+    if (ns < fgNLinear) { return static_cast<int>(ns); }
+    const auto e{static_cast<int>(std::bit_width(ns)) - 1};
+    const auto sub{static_cast<int>(ns >> (e - fgNSubBucketBit)) & (fgNSubBucket - 1)};
+    return fgNLinear + (e - fgNSubBucketBit - 1) * fgNSubBucket + sub;
+}
+
+template<std::integral T>
+auto TaskProfiler<T>::BucketLowerBound(int i) -> std::uint64_t {
+    if (i < fgNLinear) { return i; }
+    const auto e{(i - fgNLinear) / fgNSubBucket + fgNSubBucketBit + 1};
+    const auto sub{(i - fgNLinear) % fgNSubBucket};
+    return static_cast<std::uint64_t>(fgNSubBucket + sub) << (e - fgNSubBucketBit);
+}
+
+} // namespace Mustard::inline Extension::MPIX::inline Execution::internal
@@ -0,0 +1,78 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Utility/NonMoveableBase.h++"
+
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace Mustard::inline Extension::MPIX::inline Execution::internal {
+
+/// Executes tasks on worker threads. The owner thread pushes tasks to a rank-local FIFO queue and
+/// collects completions, so that only the owner thread talks to MPI and touches executor states.
+/// An exception thrown by a task stops the pool and is rethrown to the owner thread by Collect().
+template<std::integral T>
+class TaskThreadPool final : public NonMoveableBase {
+public:
+    struct Completion {
+        T task;
+        std::chrono::steady_clock::duration time;
+        int thread;
+    };
+
+public:
+    TaskThreadPool(int nThread, std::function<auto(T)->void> Execute);
+
+    auto NInFlight() const -> int { return fNInFlight; }
+
+    auto Push(T task) -> void;
+    /// Blocks until at least one task has completed, then moves all completions to the output.
+    auto Collect(std::vector<Completion>& completion) -> void;
+
+    /// Index of the worker thread calling this, or 0 if not called from a worker thread.
+    static auto ThreadIndex() -> int { return fgThreadIndex; }
+
+private:
+    std::function<auto(T)->void> fExecute;
+    int fNInFlight;
+
+    std::mutex fMutex;
+    std::condition_variable_any fTaskReady;
+    std::condition_variable fCompletionReady;
+    std::deque<T> fQueue;
+    std::vector<Completion> fCompletion;
+    std::exception_ptr fException;
+
+    std::vector<std::jthread> fWorkerThread;
+
+    static thread_local int fgThreadIndex;
+};
+
+} // namespace Mustard::inline Extension::MPIX::inline Execution::internal
+
+#include "Mustard/Extension/MPIX/Execution/internal/TaskThreadPool.inl"
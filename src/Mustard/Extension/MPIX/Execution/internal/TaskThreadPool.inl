@@ -0,0 +1,93 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::inline Extension::MPIX::inline Execution::internal {
+
+template<std::integral T>
+thread_local int TaskThreadPool<T>::fgThreadIndex{};
+
+template<std::integral T>
+TaskThreadPool<T>::TaskThreadPool(int nThread, std::function<auto(T)->void> Execute) :
+    NonMoveableBase{},
+    fExecute{std::move(Execute)},
+    fNInFlight{},
+    fMutex{},
+    fTaskReady{},
+    fCompletionReady{},
+    fQueue{},
+    fCompletion{},
+    fException{},
+    fWorkerThread{} {
+    fWorkerThread.reserve(nThread);
+    for (int i{}; i < nThread; ++i) {
+        fWorkerThread.emplace_back([this, i](std::stop_token stop) {
+            fgThreadIndex = i;
+            while (true) {
+                T task;
+                {
+                    std::unique_lock lock{fMutex};
+                    // woken up by a new task or by stop request from jthread destructor
+                    if (not fTaskReady.wait(lock, stop, [this] { return not fQueue.empty() or fException; })) { return; }
+                    if (fException) { return; }
+                    task = fQueue.front();
+                    fQueue.pop_front();
+                }
+                const auto begin{std::chrono::steady_clock::now()};
+                try {
+                    fExecute(task);
+                } catch (...) {
+                    {
+                        const std::scoped_lock lock{fMutex};
+                        if (not fException) { fException = std::current_exception(); }
+                    }
+                    fTaskReady.notify_all();
+                    fCompletionReady.notify_one();
+                    return;
+                }
+                const auto time{std::chrono::steady_clock::now() - begin};
+                {
+                    const std::scoped_lock lock{fMutex};
+                    fCompletion.push_back({task, time, i});
+                }
+                fCompletionReady.notify_one();
+            }
+        });
+    }
+}
+
+template<std::integral T>
+auto TaskThreadPool<T>::Push(T task) -> void {
+    {
+        const std::scoped_lock lock{fMutex};
+        fQueue.push_back(task);
+    }
+    ++fNInFlight;
+    fTaskReady.notify_one();
+}
+
+template<std::integral T>
+auto TaskThreadPool<T>::Collect(std::vector<Completion>& completion) -> void {
+    completion.clear();
+    std::unique_lock lock{fMutex};
+    fCompletionReady.wait(lock, [this] { return not fCompletion.empty() or fException; });
+    if (fException) { std::rethrow_exception(fException); }
+    completion.swap(fCompletion);
+    fNInFlight -= static_cast<int>(completion.size());
+}
+
+} // namespace Mustard::inline Extension::MPIX::inline Execution::internal
@@ -0,0 +1,95 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Utility/MerelyMoveableBase.h++"
+#include "Mustard/Utility/PrettyLog.h++"
+
+#include "mpi.h"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Mustard::inline Extension::MPIX {
+
+/// A read-only array shared by all processes on a node, built on MPI_Win_allocate_shared over MPIEnv::CommNode().
+/// Only the node master allocates, loads or constructs the data; other processes on the node map the same memory.
+/// Per-node memory of large read-only data (e.g. field maps, lookup tables) is then O(1) instead of O(processes).
+/// Construction and destruction are collective on CommNode.
+///
+/// For example:
+///
+///   MPIX::NodeSharedBuffer<float> table{[] { return LoadTable("table.bin"); }}; // LoadTable returns std::vector<float>
+///   Use(table[42], table.Span());
+///
+template<typename T>
+    requires(std::is_trivially_copyable_v<T> and std::is_trivially_destructible_v<T> and
+             alignof(T) <= alignof(std::max_align_t))
+class NodeSharedBuffer final : public MerelyMoveableBase {
+public:
+    using ValueType = T;
+
+public:
+    /// Node master allocates size elements and fills them by Initialize(std::span<T>).
+    /// size and Initialize are significant on node master only.
+    NodeSharedBuffer(std::size_t size, std::invocable<std::span<T>> auto&& Initialize);
+    /// Node master loads data by Load(), which returns a sized contiguous range of T, and copies them into shared memory.
+    /// Load is significant on node master only.
+    template<std::invocable<> L>
+        requires(std::ranges::contiguous_range<std::invoke_result_t<L>> and std::ranges::sized_range<std::invoke_result_t<L>> and
+                 std::same_as<std::ranges::range_value_t<std::invoke_result_t<L>>, T>)
+    explicit NodeSharedBuffer(L&& Load);
+    ~NodeSharedBuffer();
+
+    NodeSharedBuffer(NodeSharedBuffer&& that) noexcept;
+    auto operator=(NodeSharedBuffer&& that) noexcept -> NodeSharedBuffer&;
+
+    auto Data() const -> const T* { return fData; }
+    auto Size() const -> std::size_t { return fSize; }
+    auto Empty() const -> bool { return fSize == 0; }
+    auto Span() const -> std::span<const T> { return {fData, fSize}; }
+
+    auto operator[](std::size_t i) const -> const T& { return fData[i]; }
+    auto begin() const -> const T* { return fData; }
+    auto end() const -> const T* { return fData + fSize; }
+
+private:
+    auto Allocate(std::size_t size) -> T*;
+    auto Publish(std::exception_ptr exception) -> void;
+    auto Free() -> void;
+
+private:
+    MPI_Win fWindow;
+    const T* fData;
+    std::size_t fSize;
+};
+
+} // namespace Mustard::inline Extension::MPIX
+
+#include "Mustard/Extension/MPIX/NodeSharedBuffer.inl"
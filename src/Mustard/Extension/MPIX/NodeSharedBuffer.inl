@@ -0,0 +1,163 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+namespace Mustard::inline Extension::MPIX {
+
+template<typename T>
+    requires(std::is_trivially_copyable_v<T> and std::is_trivially_destructible_v<T> and
+             alignof(T) <= alignof(std::max_align_t))
+NodeSharedBuffer<T>::NodeSharedBuffer(std::size_t size, std::invocable<std::span<T>> auto&& Initialize) :
+    MerelyMoveableBase{},
+    fWindow{MPI_WIN_NULL},
+    fData{},
+    fSize{} {
+    const auto data{Allocate(size)};
+    std::exception_ptr exception;
+    if (Env::MPIEnv::Instance().OnCommNodeMaster()) {
+        try {
+            std::invoke(std::forward<decltype(Initialize)>(Initialize), std::span<T>{data, fSize});
+        } catch (...) {
+            exception = std::current_exception();
+        }
+    }
+    Publish(std::move(exception));
+}
+
+template<typename T>
+    requires(std::is_trivially_copyable_v<T> and std::is_trivially_destructible_v<T> and
+             alignof(T) <= alignof(std::max_align_t))
+template<std::invocable<> L>
+    requires(std::ranges::contiguous_range<std::invoke_result_t<L>> and std::ranges::sized_range<std::invoke_result_t<L>> and
+             std::same_as<std::ranges::range_value_t<std::invoke_result_t<L>>, T>)
+NodeSharedBuffer<T>::NodeSharedBuffer(L&& Load) :
+    MerelyMoveableBase{},
+    fWindow{MPI_WIN_NULL},
+    fData{},
+    fSize{} {
+    std::invoke_result_t<L> loaded{};
+    std::exception_ptr exception;
+    if (Env::MPIEnv::Instance().OnCommNodeMaster()) {
+        try {
+            loaded = std::invoke(std::forward<L>(Load));
+        } catch (...) {
+            exception = std::current_exception();
+        }
+    }
+    const auto data{Allocate(exception ? 0 : std::ranges::size(loaded))};
+    if (Env::MPIEnv::Instance().OnCommNodeMaster() and not exception) {
+        std::ranges::copy(loaded, data);
+    }
+    Publish(std::move(exception));
+}
+
+template<typename T>
+    requires(std::is_trivially_copyable_v<T> and std::is_trivially_destructible_v<T> and
+             alignof(T) <= alignof(std::max_align_t))
+NodeSharedBuffer<T>::~NodeSharedBuffer() {
+    Free();
+}
+
+template<typename T>
+    requires(std::is_trivially_copyable_v<T> and std::is_trivially_destructible_v<T> and
+             alignof(T) <= alignof(std::max_align_t))
+NodeSharedBuffer<T>::NodeSharedBuffer(NodeSharedBuffer&& that) noexcept :
+    MerelyMoveableBase{},
+    fWindow{std::exchange(that.fWindow, MPI_WIN_NULL)},
+    fData{std::exchange(that.fData, nullptr)},
+    fSize{std::exchange(that.fSize, 0)} {}
+
+template<typename T>
+    requires(std::is_trivially_copyable_v<T> and std::is_trivially_destructible_v<T> and
+             alignof(T) <= alignof(std::max_align_t))
+auto NodeSharedBuffer<T>::operator=(NodeSharedBuffer&& that) noexcept -> NodeSharedBuffer& {
+    if (this != &that) {
+        Free();
+        fWindow = std::exchange(that.fWindow, MPI_WIN_NULL);
+        fData = std::exchange(that.fData, nullptr);
+        fSize = std::exchange(that.fSize, 0);
+    }
+    return *this;
+}
+
+template<typename T>
+    requires(std::is_trivially_copyable_v<T> and std::is_trivially_destructible_v<T> and
+             alignof(T) <= alignof(std::max_align_t))
+auto NodeSharedBuffer<T>::Allocate(std::size_t size) -> T* {
+    const auto& mpiEnv{Env::MPIEnv::Instance()};
+    auto nElement{static_cast<unsigned long long>(size)};
+    MPI_Bcast(&nElement,              // buffer
+              1,                      // count
+              MPI_UNSIGNED_LONG_LONG, // datatype
+              0,                      // root
+              mpiEnv.CommNode());     // comm
+    void* base;
+    MPI_Win_allocate_shared(mpiEnv.OnCommNodeMaster() ? static_cast<MPI_Aint>(nElement * sizeof(T)) : 0, // size
+                            sizeof(T),                                                                   // disp_unit
+                            MPI_INFO_NULL,                                                               // info
+                            mpiEnv.CommNode(),                                                           // comm
+                            &base,                                                                       // baseptr
+                            &fWindow);                                                                   // win
+    if (mpiEnv.OnCommNodeWorker()) {
+        MPI_Aint segmentSize;
+        int dispUnit;
+        MPI_Win_shared_query(fWindow,      // win
+                             0,            // rank
+                             &segmentSize, // size
+                             &dispUnit,    // disp_unit
+                             &base);       // baseptr
+    }
+    fData = static_cast<const T*>(base);
+    fSize = nElement;
+    // open an epoch for node master to write
+    MPI_Win_fence(MPI_MODE_NOPRECEDE, // assert
+                  fWindow);           // win
+    return static_cast<T*>(base);
+}
+
+template<typename T>
+    requires(std::is_trivially_copyable_v<T> and std::is_trivially_destructible_v<T> and
+             alignof(T) <= alignof(std::max_align_t))
+auto NodeSharedBuffer<T>::Publish(std::exception_ptr exception) -> void {
+    // writes of node master are visible to the node after this
+    MPI_Win_fence(MPI_MODE_NOSUCCEED, // assert
+                  fWindow);           // win
+    // propagate failure of node master to the node
+    auto failed{static_cast<bool>(exception)};
+    MPI_Bcast(&failed,                             // buffer
+              1,                                   // count
+              MPI_CXX_BOOL,                        // datatype
+              0,                                   // root
+              Env::MPIEnv::Instance().CommNode()); // comm
+    if (not failed) { return; }
+    Free();
+    if (exception) { std::rethrow_exception(exception); }
+    throw std::runtime_error{PrettyException("Node master failed to initialize node shared buffer")};
+}
+
+template<typename T>
+    requires(std::is_trivially_copyable_v<T> and std::is_trivially_destructible_v<T> and
+             alignof(T) <= alignof(std::max_align_t))
+auto NodeSharedBuffer<T>::Free() -> void {
+    if (fWindow == MPI_WIN_NULL) { return; }
+    MPI_Win_free(&fWindow);
+    fData = nullptr;
+    fSize = 0;
+}
+
+} // namespace Mustard::inline Extension::MPIX
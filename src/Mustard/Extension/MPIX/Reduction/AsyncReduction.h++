@@ -0,0 +1,80 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Extension/MPIX/Reduction/ReductionTopology.h++"
+#include "Mustard/Extension/MPIX/Reduction/internal/ReductionRequest.h++"
+#include "Mustard/Utility/PrettyLog.h++"
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace Mustard::inline Extension::MPIX::inline Reduction {
+
+/// A non-blocking reduction of a value across all processes, by reducer R (see Reducer.h++).
+/// The value is packed when the reduction is posted, so it can be modified afterwards.
+/// On completion (Test() returns true, or Wait()), the reduced result is written back to the value
+/// on target processes (world master, or all processes). Value must outlive the reduction.
+/// The reduction progresses only in Test() and Wait(); call Test() from time to time for overlapping
+/// with computation. Reductions must be posted in the same order on all processes.
+template<typename R>
+class AsyncReduction final {
+public:
+    using Value = typename R::Value;
+    using Element = typename R::Element;
+
+public:
+    AsyncReduction(Value& value, bool toAll, ReductionTopology topology);
+
+    auto Test() -> bool;
+    auto Wait() -> Value&;
+
+    auto ToAll() const -> auto { return fToAll; }
+    auto OnTarget() const -> bool { return fToAll or Env::MPIEnv::Instance().OnCommWorldMaster(); }
+
+private:
+    auto Complete() -> void;
+
+private:
+    Value* fValue;
+    bool fToAll;
+    bool fWrittenBack;
+    std::vector<Element> fSendBuffer;
+    std::vector<Element> fRecvBuffer;
+    std::unique_ptr<internal::ReductionRequest> fRequest;
+};
+
+/// Post a non-blocking reduction of value by reducer R, result on world master.
+/// e.g. auto nEvent{MPIX::IReduce<MPIX::Sum>(localNEvent)}; ... ; nEvent.Wait();
+template<template<typename> typename R, typename T>
+auto IReduce(T& value, ReductionTopology topology = ReductionTopology::Flat) -> AsyncReduction<R<T>>;
+
+/// Post a non-blocking reduction of value by reducer R, result on all processes.
+template<template<typename> typename R, typename T>
+auto IAllReduce(T& value, ReductionTopology topology = ReductionTopology::Flat) -> AsyncReduction<R<T>>;
+
+} // namespace Mustard::inline Extension::MPIX::inline Reduction
+
+#include "Mustard/Extension/MPIX/Reduction/AsyncReduction.inl"
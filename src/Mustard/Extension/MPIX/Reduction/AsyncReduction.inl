@@ -0,0 +1,68 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+namespace Mustard::inline Extension::MPIX::inline Reduction {
+
+template<typename R>
+AsyncReduction<R>::AsyncReduction(Value& value, bool toAll, ReductionTopology topology) :
+    fValue{&value},
+    fToAll{toAll},
+    fWrittenBack{},
+    fSendBuffer{R::Pack(value)},
+    fRecvBuffer(fSendBuffer.size()),
+    fRequest{} {
+    if (fSendBuffer.size() > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+        throw std::length_error{PrettyException("Reduction buffer too large")};
+    }
+    fRequest = std::make_unique<internal::ReductionRequest>(fSendBuffer.data(), fRecvBuffer.data(), static_cast<int>(fSendBuffer.size()),
+                                                            R::DataType(), R::Operation(), toAll, topology);
+}
+
+template<typename R>
+auto AsyncReduction<R>::Test() -> bool {
+    if (not fRequest->Test()) { return false; }
+    Complete();
+    return true;
+}
+
+template<typename R>
+auto AsyncReduction<R>::Wait() -> Value& {
+    fRequest->Wait();
+    Complete();
+    return *fValue;
+}
+
+template<typename R>
+auto AsyncReduction<R>::Complete() -> void {
+    if (fWrittenBack) { return; }
+    if (OnTarget()) { R::Unpack(fRecvBuffer, *fValue); }
+    fWrittenBack = true;
+}
+
+template<template<typename> typename R, typename T>
+auto IReduce(T& value, ReductionTopology topology) -> AsyncReduction<R<T>> {
+    return {value, false, topology};
+}
+
+template<template<typename> typename R, typename T>
+auto IAllReduce(T& value, ReductionTopology topology) -> AsyncReduction<R<T>> {
+    return {value, true, topology};
+}
+
+} // namespace Mustard::inline Extension::MPIX::inline Reduction
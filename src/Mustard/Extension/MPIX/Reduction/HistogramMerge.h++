@@ -0,0 +1,57 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "Mustard/Utility/PrettyLog.h++"
+
+#include "TH1.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
+#include "TProfile3D.h"
+
+#include "mpi.h"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <stdexcept>
+#include <vector>
+
+namespace Mustard::inline Extension::MPIX::inline Reduction {
+
+/// Merges ROOT histograms of all processes, as if all entries were filled into one histogram.
+/// Histograms must have identical binning on all processes, and must not extend axes.
+/// Bin contents, sum of weight squares, statistics and number of entries are summed.
+/// The result has Sumw2 enabled, even if some processes filled without weights.
+/// Profiles are not supported.
+template<std::derived_from<TH1> T>
+struct HistogramMerge {
+    using Value = T;
+    using Element = double;
+
+    static auto Pack(const Value& value) -> std::vector<Element>;
+    static auto Unpack(const std::vector<Element>& buffer, Value& value) -> void;
+    static auto DataType() -> MPI_Datatype { return MPI_DOUBLE; }
+    static auto Operation() -> MPI_Op { return MPI_SUM; }
+};
+
+} // namespace Mustard::inline Extension::MPIX::inline Reduction
+
+#include "Mustard/Extension/MPIX/Reduction/HistogramMerge.inl"
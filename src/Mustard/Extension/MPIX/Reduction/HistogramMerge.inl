@@ -0,0 +1,64 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+namespace Mustard::inline Extension::MPIX::inline Reduction {
+
+template<std::derived_from<TH1> T>
+auto HistogramMerge<T>::Pack(const Value& value) -> std::vector<Element> {
+    if (value.InheritsFrom(TProfile::Class()) or value.InheritsFrom(TProfile2D::Class()) or value.InheritsFrom(TProfile3D::Class())) {
+        throw std::invalid_argument{PrettyException("Profile histograms are not supported")};
+    }
+    if (value.CanExtendAllAxes()) {
+        throw std::invalid_argument{PrettyException("Histogram with extendable axes cannot be merged (binning may differ)")};
+    }
+    // layout: bin contents, sum of weight squares, statistics, number of entries.
+    // Sum of weight squares is always packed so that buffer sizes agree on all processes,
+    // without Sumw2 they equal bin contents (unit weights)
+    const auto nCell{value.GetNcells()};
+    std::vector<Element> buffer(2 * nCell + TH1::kNstat + 1);
+    for (int i{}; i < nCell; ++i) {
+        buffer[i] = value.GetBinContent(i);
+    }
+    if (value.GetSumw2N() > 0) {
+        std::ranges::copy_n(value.GetSumw2()->GetArray(), nCell, buffer.begin() + nCell);
+    } else {
+        std::ranges::copy_n(buffer.cbegin(), nCell, buffer.begin() + nCell);
+    }
+    value.GetStats(buffer.data() + 2 * nCell);
+    buffer.back() = value.GetEntries();
+    return buffer;
+}
+
+template<std::derived_from<TH1> T>
+auto HistogramMerge<T>::Unpack(const std::vector<Element>& buffer, Value& value) -> void {
+    const auto nCell{value.GetNcells()};
+    for (int i{}; i < nCell; ++i) {
+        value.SetBinContent(i, buffer[i]);
+    }
+    // some processes may have filled with weights
+    if (value.GetSumw2N() == 0) { value.Sumw2(); }
+    std::ranges::copy_n(buffer.cbegin() + nCell, nCell, value.GetSumw2()->GetArray());
+    // SetBinContent touches statistics and entries, set them afterwards
+    std::array<Element, TH1::kNstat> stats;
+    std::ranges::copy_n(buffer.cbegin() + 2 * nCell, TH1::kNstat, stats.begin());
+    value.PutStats(stats.data());
+    value.SetEntries(buffer.back());
+}
+
+} // namespace Mustard::inline Extension::MPIX::inline Reduction
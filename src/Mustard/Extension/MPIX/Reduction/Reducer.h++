@@ -0,0 +1,60 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "Mustard/Extension/MPIX/Reduction/internal/PredefinedReducer.h++"
+
+#include "mpi.h"
+
+#include <complex>
+#include <concepts>
+
+namespace Mustard::inline Extension::MPIX::inline Reduction {
+
+// A reducer R for values of type R::Value provides:
+//   R::Element:                            element type of the reduction buffer,
+//   R::Pack(const Value&):                 value -> std::vector<Element>,
+//   R::Unpack(const std::vector<Element>&, Value&): reduced buffer -> value,
+//   R::DataType(), R::Operation():         MPI datatype of Element and MPI operation on it.
+
+/// Sum of an MPI predefined value, or element-wise sum of a contiguous range of them.
+template<internal::PredefinedReducible T>
+    requires(not std::same_as<typename internal::PredefinedReducer<T>::Element, bool>)
+struct Sum : internal::PredefinedReducer<T> {
+    static auto Operation() -> MPI_Op { return MPI_SUM; }
+};
+
+/// Minimum of an MPI predefined value, or element-wise minimum of a contiguous range of them.
+template<internal::PredefinedReducible T>
+    requires(std::totally_ordered<typename internal::PredefinedReducer<T>::Element> and
+             not std::same_as<typename internal::PredefinedReducer<T>::Element, bool>)
+struct Min : internal::PredefinedReducer<T> {
+    static auto Operation() -> MPI_Op { return MPI_MIN; }
+};
+
+/// Maximum of an MPI predefined value, or element-wise maximum of a contiguous range of them.
+template<internal::PredefinedReducible T>
+    requires(std::totally_ordered<typename internal::PredefinedReducer<T>::Element> and
+             not std::same_as<typename internal::PredefinedReducer<T>::Element, bool>)
+struct Max : internal::PredefinedReducer<T> {
+    static auto Operation() -> MPI_Op { return MPI_MAX; }
+};
+
+} // namespace Mustard::inline Extension::MPIX::inline Reduction
@@ -0,0 +1,33 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+namespace Mustard::inline Extension::MPIX::inline Reduction {
+
+/// How a reduction is carried out across processes.
+///   Flat:             a single collective on all processes.
+///   NodeHierarchical: reduce within each node first, then across node masters
+///                     (and broadcast back within each node if result is needed on all processes).
+enum struct ReductionTopology {
+    Flat,
+    NodeHierarchical
+};
+
+} // namespace Mustard::inline Extension::MPIX::inline Reduction
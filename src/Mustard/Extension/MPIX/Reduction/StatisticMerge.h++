@@ -0,0 +1,49 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "Mustard/Math/Statistic.h++"
+
+#include "mpi.h"
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace Mustard::inline Extension::MPIX::inline Reduction {
+
+template<typename>
+struct StatisticMerge;
+
+/// Merges Math::Statistic of all processes, as if all samples were filled into one statistic.
+template<int N>
+struct StatisticMerge<Math::Statistic<N>> {
+    using Value = Math::Statistic<N>;
+    using Element = Math::Statistic<N>;
+
+    static auto Pack(const Value& value) -> std::vector<Element> { return {value}; }
+    static auto Unpack(const std::vector<Element>& buffer, Value& value) -> void { value = buffer.front(); }
+    static auto DataType() -> MPI_Datatype;
+    static auto Operation() -> MPI_Op;
+};
+
+} // namespace Mustard::inline Extension::MPIX::inline Reduction
+
+#include "Mustard/Extension/MPIX/Reduction/StatisticMerge.inl"
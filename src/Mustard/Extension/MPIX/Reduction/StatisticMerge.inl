@@ -0,0 +1,64 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+namespace Mustard::inline Extension::MPIX::inline Reduction {
+
+template<int N>
+auto StatisticMerge<Math::Statistic<N>>::DataType() -> MPI_Datatype {
+    // Created on first use and lives until MPI_Finalize
+    static const auto dataType{
+        [] {
+            MPI_Datatype dataType;
+            MPI_Type_contiguous(sizeof(Element), // count
+                                MPI_BYTE,        // oldtype
+                                &dataType);      // newtype
+            MPI_Type_commit(&dataType);
+            return dataType;
+        }()};
+    return dataType;
+}
+
+template<int N>
+auto StatisticMerge<Math::Statistic<N>>::Operation() -> MPI_Op {
+    // Created on first use and lives until MPI_Finalize
+    static const auto operation{
+        [] {
+            MPI_Op operation;
+            MPI_Op_create(
+                [](void* in, void* inout, int* len, MPI_Datatype*) {
+                    // buffers from MPI may be insufficiently aligned for Eigen, copy before merging
+                    const auto inBytes{static_cast<const std::byte*>(in)};
+                    const auto inoutBytes{static_cast<std::byte*>(inout)};
+                    Element a;
+                    Element b;
+                    for (int i{}; i < *len; ++i) {
+                        std::memcpy(static_cast<void*>(&a), inBytes + i * sizeof(Element), sizeof(Element));
+                        std::memcpy(static_cast<void*>(&b), inoutBytes + i * sizeof(Element), sizeof(Element));
+                        b += a;
+                        std::memcpy(inoutBytes + i * sizeof(Element), &b, sizeof(Element));
+                    }
+                }, // user_fn
+                true,        // commute
+                &operation); // op
+            return operation;
+        }()};
+    return operation;
+}
+
+} // namespace Mustard::inline Extension::MPIX::inline Reduction
@@ -0,0 +1,62 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "Mustard/Concept/MPIPredefined.h++"
+#include "Mustard/Extension/MPIX/DataType.h++"
+
+#include "mpi.h"
+
+#include <algorithm>
+#include <concepts>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+namespace Mustard::inline Extension::MPIX::inline Reduction::internal {
+
+template<typename T>
+concept PredefinedReducible =
+    Concept::MPIPredefined<T> or
+    (std::ranges::contiguous_range<T> and std::ranges::sized_range<T> and
+     Concept::MPIPredefined<std::ranges::range_value_t<T>>);
+
+template<typename T>
+struct PredefinedReducibleElement : std::type_identity<T> {};
+
+template<std::ranges::range T>
+struct PredefinedReducibleElement<T> : std::type_identity<std::ranges::range_value_t<T>> {};
+
+/// Reduces an MPI predefined value, or element-wise a contiguous range of MPI predefined values, with a predefined operation.
+template<PredefinedReducible T>
+class PredefinedReducer {
+public:
+    using Value = T;
+    using Element = typename PredefinedReducibleElement<T>::type;
+
+public:
+    static auto Pack(const Value& value) -> std::vector<Element>;
+    static auto Unpack(const std::vector<Element>& buffer, Value& value) -> void;
+    static auto DataType() -> MPI_Datatype { return MPIX::DataType<Element>(); }
+};
+
+} // namespace Mustard::inline Extension::MPIX::inline Reduction::internal
+
+#include "Mustard/Extension/MPIX/Reduction/internal/PredefinedReducer.inl"
@@ -0,0 +1,40 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+namespace Mustard::inline Extension::MPIX::inline Reduction::internal {
+
+template<PredefinedReducible T>
+auto PredefinedReducer<T>::Pack(const Value& value) -> std::vector<Element> {
+    if constexpr (std::ranges::range<T>) {
+        return {std::ranges::cbegin(value), std::ranges::cend(value)};
+    } else {
+        return {value};
+    }
+}
+
+template<PredefinedReducible T>
+auto PredefinedReducer<T>::Unpack(const std::vector<Element>& buffer, Value& value) -> void {
+    if constexpr (std::ranges::range<T>) {
+        std::ranges::copy_n(buffer.cbegin(), std::ranges::ssize(value), std::ranges::begin(value));
+    } else {
+        value = buffer.front();
+    }
+}
+
+} // namespace Mustard::inline Extension::MPIX::inline Reduction::internal
@@ -0,0 +1,200 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Extension/MPIX/Reduction/internal/ReductionRequest.h++"
+
+#include <algorithm>
+#include <deque>
+
+namespace Mustard::inline Extension::MPIX::inline Reduction::internal {
+
+namespace {
+
+struct Communicator {
+    MPI_Comm world;
+    MPI_Comm node;
+    MPI_Comm interNode; // node masters only, MPI_COMM_NULL on others
+};
+
+auto PrivateCommunicator() -> const Communicator& {
+    // Duplicated once on first reduction (collective), so that staged collectives never interleave
+    // with collectives posted by other code. They live until MPI_Finalize.
+    static const auto comm{
+        [] {
+            const auto& mpiEnv{Env::MPIEnv::Instance()};
+            Communicator comm;
+            MPI_Comm_dup(MPI_COMM_WORLD, // comm
+                         &comm.world);   // newcomm
+            MPI_Comm_dup(mpiEnv.CommNode(), // comm
+                         &comm.node);       // newcomm
+            MPI_Comm_split(comm.world,                                        // comm
+                           mpiEnv.OnCommNodeMaster() ? 0 : MPI_UNDEFINED, // color
+                           mpiEnv.CommWorldRank(),                            // key
+                           &comm.interNode);                                  // newcomm
+            return comm;
+        }()};
+    return comm;
+}
+
+auto Queue() -> std::deque<ReductionRequest*>& {
+    static std::deque<ReductionRequest*> queue;
+    return queue;
+}
+
+} // namespace
+
+ReductionRequest::ReductionRequest(const void* sendBuffer, void* recvBuffer, int count, MPI_Datatype dataType, MPI_Op operation,
+                                   bool toAll, ReductionTopology topology) :
+    NonMoveableBase{},
+    fSendBuffer{sendBuffer},
+    fRecvBuffer{recvBuffer},
+    fCount{count},
+    fDataType{dataType},
+    fOperation{operation},
+    fToAll{toAll},
+    fTopology{topology},
+    fNextStage{},
+    fRequest{MPI_REQUEST_NULL},
+    fCompleted{} {
+    PrivateCommunicator();
+    Queue().push_back(this);
+    Progress();
+}
+
+ReductionRequest::~ReductionRequest() {
+    Wait();
+}
+
+auto ReductionRequest::Test() -> bool {
+    if (not fCompleted) { Progress(); }
+    return fCompleted;
+}
+
+auto ReductionRequest::Wait() -> void {
+    while (not fCompleted) { Progress(); }
+}
+
+auto ReductionRequest::StageRequired(int stage) const -> bool {
+    const auto& mpiEnv{Env::MPIEnv::Instance()};
+    switch (stage) {
+    case 0: // flat reduction, or reduction within node
+        return true;
+    case 1: // reduction across node masters
+        return fTopology == ReductionTopology::NodeHierarchical and mpiEnv.OnCommNodeMaster() and mpiEnv.OnCluster();
+    case 2: // broadcast within node
+        return fTopology == ReductionTopology::NodeHierarchical and fToAll and mpiEnv.CommNodeSize() > 1;
+    default:
+        return false;
+    }
+}
+
+auto ReductionRequest::PostStage(int stage) -> void {
+    const auto& comm{PrivateCommunicator()};
+    switch (stage) {
+    case 0:
+        if (fTopology == ReductionTopology::Flat and fToAll) {
+            MPI_Iallreduce(fSendBuffer, // sendbuf
+                           fRecvBuffer, // recvbuf
+                           fCount,      // count
+                           fDataType,   // datatype
+                           fOperation,  // op
+                           comm.world,  // comm
+                           &fRequest);  // request
+        } else {
+            MPI_Ireduce(fSendBuffer,                                                     // sendbuf
+                        fRecvBuffer,                                                     // recvbuf
+                        fCount,                                                          // count
+                        fDataType,                                                       // datatype
+                        fOperation,                                                      // op
+                        0,                                                               // root
+                        fTopology == ReductionTopology::Flat ? comm.world : comm.node, // comm
+                        &fRequest);                                                      // request
+        }
+        break;
+    case 1:
+        if (fToAll) {
+            MPI_Iallreduce(MPI_IN_PLACE,   // sendbuf
+                           fRecvBuffer,    // recvbuf
+                           fCount,         // count
+                           fDataType,      // datatype
+                           fOperation,     // op
+                           comm.interNode, // comm
+                           &fRequest);     // request
+        } else {
+            MPI_Ireduce(Env::MPIEnv::Instance().OnCommWorldMaster() ? MPI_IN_PLACE : fRecvBuffer, // sendbuf
+                        fRecvBuffer,                                                              // recvbuf
+                        fCount,                                                                   // count
+                        fDataType,                                                                // datatype
+                        fOperation,                                                               // op
+                        0,                                                                        // root
+                        comm.interNode,                                                           // comm
+                        &fRequest);                                                               // request
+        }
+        break;
+    case 2:
+        MPI_Ibcast(fRecvBuffer, // buffer
+                   fCount,      // count
+                   fDataType,   // datatype
+                   0,           // root
+                   comm.node,   // comm
+                   &fRequest);  // request
+        break;
+    }
+}
+
+auto ReductionRequest::PostNextStage() -> bool {
+    while (fNextStage < fgNStage and not StageRequired(fNextStage)) { ++fNextStage; }
+    if (fNextStage == fgNStage) { return false; }
+    PostStage(fNextStage++);
+    return true;
+}
+
+auto ReductionRequest::AllStagePosted() const -> bool {
+    for (auto stage{fNextStage}; stage < fgNStage; ++stage) {
+        if (StageRequired(stage)) { return false; }
+    }
+    return true;
+}
+
+auto ReductionRequest::Progress() -> void {
+    auto& queue{Queue()};
+    for (auto i{queue.begin()}; i != queue.end();) {
+        auto& request{**i};
+        while (not request.fCompleted) {
+            if (request.fRequest != MPI_REQUEST_NULL) {
+                int completed;
+                MPI_Test(&request.fRequest,  // request
+                         &completed,         // flag
+                         MPI_STATUS_IGNORE); // status
+                if (not completed) { break; }
+            }
+            if (not request.PostNextStage()) { request.fCompleted = true; }
+        }
+        if (request.fCompleted) {
+            i = queue.erase(i);
+            continue;
+        }
+        // later requests cannot post anything before this one has posted all its stages
+        if (not request.AllStagePosted()) { break; }
+        ++i;
+    }
+}
+
+} // namespace Mustard::inline Extension::MPIX::inline Reduction::internal
@@ -0,0 +1,66 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "Mustard/Extension/MPIX/Reduction/ReductionTopology.h++"
+#include "Mustard/Utility/NonMoveableBase.h++"
+
+#include "mpi.h"
+
+namespace Mustard::inline Extension::MPIX::inline Reduction::internal {
+
+/// A non-blocking reduction of at most 3 stages (see ReductionTopology), on communicators private to reductions.
+/// A stage is posted only after the previous one completed. To keep collectives matched on all processes,
+/// requests post their stages in creation order, which is enforced by a queue progressed by Test() and Wait().
+/// Not thread-safe.
+class ReductionRequest final : public NonMoveableBase {
+public:
+    ReductionRequest(const void* sendBuffer, void* recvBuffer, int count, MPI_Datatype dataType, MPI_Op operation,
+                     bool toAll, ReductionTopology topology);
+    ~ReductionRequest();
+
+    auto Test() -> bool;
+    auto Wait() -> void;
+
+private:
+    auto StageRequired(int stage) const -> bool;
+    auto PostStage(int stage) -> void;
+    auto PostNextStage() -> bool;
+    auto AllStagePosted() const -> bool;
+
+    static auto Progress() -> void;
+
+private:
+    const void* fSendBuffer;
+    void* fRecvBuffer;
+    int fCount;
+    MPI_Datatype fDataType;
+    MPI_Op fOperation;
+    bool fToAll;
+    ReductionTopology fTopology;
+
+    int fNextStage;
+    MPI_Request fRequest;
+    bool fCompleted;
+
+    static constexpr auto fgNStage{3};
+};
+
+} // namespace Mustard::inline Extension::MPIX::inline Reduction::internal
@@ -0,0 +1,31 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Math {
+
+constexpr BFloat16::BFloat16(float x) :
+    fBits{} {
+    const auto bits{std::bit_cast<std::uint32_t>(x)};
+    if ((bits & 0x7fffffff) > 0x7f800000) {
+        fBits = static_cast<std::uint16_t>(bits >> 16 | 0x40); // keep NaN a (quiet) NaN
+    } else {
+        fBits = static_cast<std::uint16_t>((bits + 0x7fff + (bits >> 16 & 1)) >> 16);
+    }
+}
+
+} // namespace Mustard::Math
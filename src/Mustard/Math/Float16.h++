@@ -0,0 +1,43 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+namespace Mustard::Math {
+
+/// @brief IEEE 754 binary16 (half precision): 5-bit exponent and 10-bit mantissa, 11 significant
+/// bits, normal range 6.1e-5 to 65504. For compact storage only, convert to float for arithmetic.
+class Float16 {
+public:
+    Float16() = default;
+    /// @brief Rounds to nearest even. Overflows to infinity.
+    constexpr explicit Float16(float x);
+
+    constexpr explicit operator float() const;
+    constexpr auto Bits() const -> std::uint16_t { return fBits; }
+
+private:
+    std::uint16_t fBits;
+};
+
+} // namespace Mustard::Math
+
+#include "Mustard/Math/Float16.inl"
@@ -0,0 +1,54 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Math {
+
+constexpr Float16::Float16(float x) :
+    fBits{} {
+    const auto bits{std::bit_cast<std::uint32_t>(x)};
+    const auto sign{static_cast<std::uint16_t>(bits >> 16 & 0x8000)};
+    const auto magnitude{bits & 0x7fffffff};
+    if (magnitude > 0x7f800000) { // NaN
+        fBits = sign | 0x7e00;
+    } else if (magnitude >= 0x477ff000) { // rounds to or beyond 65520
+        fBits = sign | 0x7c00;
+    } else if (magnitude >= 0x38800000) { // normal, rebias exponent from 127 to 15
+        const auto rounded{magnitude + 0xfff + (magnitude >> 13 & 1)};
+        fBits = sign | static_cast<std::uint16_t>((rounded - 0x38000000) >> 13);
+    } else if (magnitude > 0x33000000) { // subnormal, value is mantissa * 2^-24
+        const auto shift{126 - (magnitude >> 23)};
+        const auto mantissa{(magnitude & 0x7fffff) | 0x800000};
+        const auto remainder{mantissa & ((1u << shift) - 1)};
+        const auto halfway{1u << (shift - 1)};
+        const auto rounded{(mantissa >> shift) + (remainder > halfway or (remainder == halfway and (mantissa >> shift & 1)))};
+        fBits = sign | static_cast<std::uint16_t>(rounded);
+    } else { // underflow
+        fBits = sign;
+    }
+}
+
+constexpr Float16::operator float() const {
+    // place sign, exponent and mantissa in a float and rebias the exponent by multiplying 2^112,
+    // which also normalizes subnormals
+    const auto bits{static_cast<std::uint32_t>(fBits & 0x8000) << 16 |
+                    static_cast<std::uint32_t>(fBits & 0x7fff) << 13 |
+                    ((fBits & 0x7c00) == 0x7c00 ? 0x7f800000 : 0)}; // infinity or NaN
+    return std::bit_cast<float>(bits) * 0x1p112f;
+}
+
+} // namespace Mustard::Math
@@ -58,6 +58,8 @@ public:
     template<std::ranges::input_range S = std::initializer_list<double>, std::ranges::input_range W = std::initializer_list<double>>
         requires std::convertible_to<std::ranges::range_value_t<S>, double> and std::convertible_to<std::ranges::range_value_t<W>, double>
     constexpr auto Fill(const S& sample, const W& weight) -> void;
+    /// Merge with statistic of another sample
+    constexpr auto operator+=(const Statistic& that) -> Statistic&;
 
     constexpr auto Sum() const -> const auto& { return fSumWX; }
     constexpr auto SumProduct() const -> const auto& { return fSumWX2; }
@@ -116,6 +118,8 @@ public:
     template<std::ranges::input_range S = std::initializer_list<Eigen::Vector<double, N>>, std::ranges::input_range W = std::initializer_list<double>>
         requires Concept::InputVectorAny<std::ranges::range_value_t<S>, N> and std::convertible_to<std::ranges::range_value_t<W>, double>
     auto Fill(const S& sample, const W& weight) -> void;
+    /// Merge with statistic of another sample
+    auto operator+=(const Statistic& that) -> Statistic&;
 
     auto Sum(int i) const -> decltype(auto) { return fSumWX[i]; }
     auto SumProduct(int i, int j) const -> decltype(auto) { return fSumWXX(i, j); }
@@ -69,6 +69,15 @@ constexpr auto Statistic<1>::Fill(const S& sample, const W& weight) -> void {
     }
 }
 
+constexpr auto Statistic<1>::operator+=(const Statistic& that) -> Statistic& {
+    fSumWX += that.fSumWX;
+    fSumWX2 += that.fSumWX2;
+    fSumWX3 += that.fSumWX3;
+    fSumWX4 += that.fSumWX4;
+    fSumW += that.fSumW;
+    return *this;
+}
+
 template<int K>
     requires(0 <= K and K <= 4)
 constexpr auto Statistic<1>::Moment() const -> double {
@@ -92,10 +101,10 @@ constexpr auto Statistic<1>::CentralMoment() const -> double {
 template<int N>
     requires(N > 0)
 Statistic<N>::Statistic() :
-    fSumWX{},
-    fSumWXX{},
-    fSumWX3{},
-    fSumWX4{},
+    fSumWX{Eigen::Vector<double, N>::Zero()},
+    fSumWXX{Eigen::Matrix<double, N, N>::Zero()},
+    fSumWX3{Eigen::Vector<double, N>::Zero()},
+    fSumWX4{Eigen::Vector<double, N>::Zero()},
     fSumW{} {}
 
 template<int N>
@@ -157,6 +166,17 @@ auto Statistic<N>::Fill(const S& sample, const W& weight) -> void {
     }
 }
 
+template<int N>
+    requires(N > 0)
+auto Statistic<N>::operator+=(const Statistic& that) -> Statistic& {
+    fSumWX += that.fSumWX;
+    fSumWXX += that.fSumWXX;
+    fSumWX3 += that.fSumWX3;
+    fSumWX4 += that.fSumWX4;
+    fSumW += that.fSumW;
+    return *this;
+}
+
 template<int N>
     requires(N > 0)
 template<int K>
@@ -0,0 +1,83 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Utility/MappedFile.h++"
+#include "Mustard/Utility/PrettyLog.h++"
+
+#include "fmt/format.h"
+
+#include <cerrno>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#if defined _WIN32
+#    define WIN32_LEAN_AND_MEAN
+#    define NOMINMAX
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+namespace Mustard::inline Utility {
+
+MappedFile::MappedFile(const std::filesystem::path& path) :
+    NonMoveableBase{},
+    fAddress{},
+    fSize{} {
+    const auto Fail{[&path](const std::string& what) {
+        throw std::runtime_error{PrettyException(fmt::format("Cannot map file '{}' ({})", path.generic_string(), what))};
+    }};
+    std::error_code error;
+    fSize = std::filesystem::file_size(path, error);
+    if (error) { Fail(error.message()); }
+    if (fSize == 0) { return; } // nothing to map
+#if defined _WIN32
+    const auto file{CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr)};
+    if (file == INVALID_HANDLE_VALUE) { Fail("CreateFileW failed"); }
+    const auto mapping{CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr)};
+    CloseHandle(file);
+    if (mapping == nullptr) { Fail("CreateFileMappingW failed"); }
+    fAddress = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping); // the view keeps the mapping alive
+    if (fAddress == nullptr) { Fail("MapViewOfFile failed"); }
+#else
+    const auto file{open(path.c_str(), O_RDONLY)};
+    if (file < 0) { Fail(std::generic_category().message(errno)); }
+    fAddress = mmap(nullptr, fSize, PROT_READ, MAP_SHARED, file, 0);
+    const auto mmapError{errno};
+    close(file); // the mapping keeps the file alive
+    if (fAddress == MAP_FAILED) {
+        fAddress = nullptr;
+        Fail(std::generic_category().message(mmapError));
+    }
+#endif
+}
+
+MappedFile::~MappedFile() {
+    if (fAddress == nullptr) { return; }
+#if defined _WIN32
+    UnmapViewOfFile(fAddress);
+#else
+    munmap(fAddress, fSize);
+#endif
+}
+
+} // namespace Mustard::inline Utility
@@ -0,0 +1,44 @@
+// -*- C++ -*-
+//
+// Copyright 2020-2024  The Mustard development team
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Utility/NonMoveableBase.h++"
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace Mustard::inline Utility {
+
+/// @brief A read-only memory mapping of a whole file. Pages are loaded on first access,
+/// and mappings of the same file in different processes share the page cache.
+/// @exception Throw a std::runtime_error if the file cannot be mapped.
+class MappedFile final : public NonMoveableBase {
+public:
+    explicit MappedFile(const std::filesystem::path& path);
+    ~MappedFile();
+
+    auto Data() const -> std::span<const std::byte> { return {static_cast<const std::byte*>(fAddress), fSize}; }
+
+private:
+    void* fAddress;
+    std::size_t fSize;
+};
+
+} // namespace Mustard::inline Utility
@@ -0,0 +1,122 @@
+#include "Mustard/Detector/Field/AsG4Field.h++"
+#include "Mustard/Detector/Field/MagneticFieldMap.h++"
+#include "Mustard/Detector/Field/ToroidField.h++"
+#include "Mustard/Detector/Field/UniformElectricField.h++"
+#include "Mustard/Detector/Field/UniformElectromagneticField.h++"
+#include "Mustard/Detector/Field/UniformMagneticField.h++"
+
+#include "Eigen/Core"
+
+#include "muc/time"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace Mustard;
+
+// A trilinear map on a synthetic solenoid-like field, standing in for EFM::FieldMap3D
+class SyntheticMap {
+public:
+    using CoordinateType = double;
+
+    SyntheticMap(int n, double halfSize) :
+        fN{n},
+        fX0{-halfSize},
+        fDx{2 * halfSize / (n - 1)},
+        fNode(n * n * n) {
+        for (int i{}; i < n; ++i) {
+            for (int j{}; j < n; ++j) {
+                for (int k{}; k < n; ++k) {
+                    const auto x{fX0 + i * fDx}, y{fX0 + j * fDx}, z{fX0 + k * fDx};
+                    const auto bz{1 / (1 + (z * z) / (halfSize * halfSize))};
+                    fNode[(i * n + j) * n + k] = {-0.5 * x * z * bz, -0.5 * y * z * bz, bz};
+                }
+            }
+        }
+    }
+
+    auto operator()(double x, double y, double z) const -> Eigen::Vector3d {
+        const auto u{(x - fX0) / fDx}, v{(y - fX0) / fDx}, w{(z - fX0) / fDx};
+        const auto i{std::clamp(static_cast<int>(u), 0, fN - 2)},
+            j{std::clamp(static_cast<int>(v), 0, fN - 2)},
+            k{std::clamp(static_cast<int>(w), 0, fN - 2)};
+        const auto fu{u - i}, fv{v - j}, fw{w - k};
+        const auto at{[&](int a, int b, int c) -> const Eigen::Vector3d& { return fNode[((i + a) * fN + j + b) * fN + k + c]; }};
+        return (1 - fu) * ((1 - fv) * ((1 - fw) * at(0, 0, 0) + fw * at(0, 0, 1)) + fv * ((1 - fw) * at(0, 1, 0) + fw * at(0, 1, 1))) +
+               fu * ((1 - fv) * ((1 - fw) * at(1, 0, 0) + fw * at(1, 0, 1)) + fv * ((1 - fw) * at(1, 1, 0) + fw * at(1, 1, 1)));
+    }
+
+private:
+    int fN;
+    double fX0;
+    double fDx;
+    std::vector<Eigen::Vector3d> fNode;
+};
+
+// What AsG4Field::GetFieldValue did before the magnetic/electric-only paths
+template<typename AField>
+auto GenericGetFieldValue(const AField& field, const double* x, double* f) -> void {
+    std::ranges::copy(std::bit_cast<std::array<double, 6>>(field.BE(muc::array3d{x[0], x[1], x[2]})), f);
+}
+
+template<typename AField>
+auto Benchmark(const char* name, const AField& field, const std::vector<std::array<double, 4>>& point) -> void {
+    std::array<double, 6> f{};
+    double sum{};
+    for (auto&& x : point) {
+        field.GetFieldValue(x.data(), f.data());
+        GenericGetFieldValue(field, x.data(), f.data());
+    }
+    muc::wall_time_stopwatch<> stopwatch;
+    for (auto&& x : point) {
+        GenericGetFieldValue(field, x.data(), f.data());
+        sum += f[2] + f[5];
+    }
+    const auto genericTime{stopwatch.ms_elapsed()};
+    stopwatch = {};
+    for (auto&& x : point) {
+        field.GetFieldValue(x.data(), f.data());
+        sum += f[2] + f[5];
+    }
+    const auto time{stopwatch.ms_elapsed()};
+    std::cout << name << ":\n"
+              << "    6-component path : " << genericTime * 1e6 / point.size() << " ns/eval\n"
+              << "    3-component path : " << time * 1e6 / point.size() << " ns/eval"
+              << " (speedup: " << genericTime / time << ", checksum: " << sum << ')' << std::endl;
+}
+
+// GetFieldValue writes (B, E) for electric and electromagnetic fields, B only for magnetic fields
+auto CheckValue(const char* name, const G4Field& field, std::array<double, 6> expected, int nWritten) -> bool {
+    const double x[4]{0.1, 0.2, 0.3, 0};
+    std::array<double, 6> f;
+    f.fill(-999);
+    field.GetFieldValue(x, f.data());
+    auto ok{true};
+    for (int i{}; i < 6; ++i) { ok = ok and f[i] == (i < nWritten ? expected[i] : -999); }
+    std::cout << name << " value: " << (ok ? "ok" : "wrong") << std::endl;
+    return ok;
+}
+
+int main() {
+    auto ok{true};
+    ok = CheckValue("UniformMagneticField", Detector::Field::AsG4Field<Detector::Field::UniformMagneticField>{1, 2, 3}, {1, 2, 3}, 3) and ok;
+    ok = CheckValue("UniformElectricField", Detector::Field::AsG4Field<Detector::Field::UniformElectricField>{4, 5, 6}, {0, 0, 0, 4, 5, 6}, 6) and ok;
+    ok = CheckValue("UniformElectromagneticField", Detector::Field::AsG4Field<Detector::Field::UniformElectromagneticField>{1, 2, 3, 4, 5, 6}, {1, 2, 3, 4, 5, 6}, 6) and ok;
+
+    std::mt19937_64 random;
+    std::uniform_real_distribution<double> uniform{-1, 1};
+    std::vector<std::array<double, 4>> point(4'000'000);
+    for (auto&& x : point) { x = {uniform(random), uniform(random), uniform(random), 0}; }
+
+    Benchmark("ToroidField", Detector::Field::AsG4Field<Detector::Field::ToroidField>{1, 0.5, Eigen::Vector3d{0, 0, 0}, Eigen::Vector3d{0, 0, 1}}, point);
+    Benchmark("MagneticFieldMap", Detector::Field::AsG4Field<Detector::Field::MagneticFieldMap<SyntheticMap>>{101, 1}, point);
+    Benchmark("UniformElectricField", Detector::Field::AsG4Field<Detector::Field::UniformElectricField>{0, 0, 1}, point);
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,53 @@
+#include "Mustard/Detector/Field/BakeField.h++"
+#include "Mustard/Detector/Field/UniformMagneticField.h++"
+#include "Mustard/Env/MPIEnv.h++"
+
+#include "mpi.h"
+
+#include "muc/array"
+
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+
+using namespace Mustard;
+using namespace Mustard::Detector::Field;
+
+// processes bake into the same cache file concurrently, see BakeField
+int main(int argc, char* argv[]) {
+    Env::MPIEnv env{argc, argv, {}};
+
+    const muc::array3d x0{-1, -1, -1};
+    const muc::array3d x1{1, 1, 1};
+    const std::array n{11, 11, 11};
+    const auto cache{std::filesystem::temp_directory_path() / "Mustard_BakeFieldMPI_test.mfm"};
+    if (env.OnCommWorldMaster()) { std::filesystem::remove(cache); }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    auto ok{true};
+    const muc::array3d x{0.1, -0.2, 0.3};
+    // baked, then mapped from the file, then rebaked as the file is stale
+    for (auto&& b : {muc::array3d{1, 2, 3}, muc::array3d{1, 2, 3}, muc::array3d{3, 2, 1}}) {
+        const auto baked{BakeField(UniformMagneticField{b}, x0, x1, n, cache)};
+        ok = ok and baked.B(x) == b;
+    }
+
+    // no temporary file is left behind
+    MPI_Barrier(MPI_COMM_WORLD);
+    for (auto&& entry : std::filesystem::directory_iterator{cache.parent_path()}) {
+        const auto name{entry.path().filename().generic_string()};
+        if (name.starts_with(cache.filename().generic_string()) and name.ends_with(".tmp")) {
+            std::cout << "Temporary file '" << name << "' left\n";
+            ok = false;
+        }
+    }
+
+    auto allOk{ok};
+    MPI_Allreduce(&ok, &allOk, 1, MPI_CXX_BOOL, MPI_LAND, MPI_COMM_WORLD);
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (env.OnCommWorldMaster()) {
+        std::filesystem::remove(cache);
+        std::cout << (allOk ? "Passed\n" : "Failed\n");
+    }
+    return allOk ? EXIT_SUCCESS : EXIT_FAILURE;
+}
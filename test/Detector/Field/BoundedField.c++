@@ -0,0 +1,132 @@
+#include "Mustard/Detector/Field/AsG4Field.h++"
+#include "Mustard/Detector/Field/BoundedField.h++"
+#include "Mustard/Detector/Field/FieldSuperposition.h++"
+#include "Mustard/Detector/Field/GridFieldMap3D.h++"
+#include "Mustard/Detector/Field/MagneticFieldMap.h++"
+#include "Mustard/Detector/Field/UniformElectricField.h++"
+#include "Mustard/Detector/Field/UniformElectromagneticField.h++"
+
+#include "Eigen/Core"
+#include "Eigen/Geometry"
+
+#include "muc/array"
+#include "muc/time"
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Mustard::Detector::Field;
+
+using Map = MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d>>;
+
+auto Linear(double x, double y, double z) -> Eigen::Vector3d { return {1 + 0.5 * x, 2 - 0.25 * y + 0.1 * z, 0.3 * x - z}; }
+
+int main() {
+    auto ok{true};
+    static_assert(MagneticField<BoundedField<Map>> and MagneticField<BoundedField<Map, "Extrapolate">>);
+
+    const muc::array3d x0{-1, -2, -3};
+    const muc::array3d x1{1, 2, 3};
+    const std::array n{11, 21, 31};
+    const BoundedField<Map> zero{x0, x1, x0, x1, n, Linear};
+    const BoundedField<Map, "Clamp"> clamp{x0, x1, x0, x1, n, Linear};
+    const BoundedField<Map, "Extrapolate"> extrapolate{x0, x1, x0, x1, n, Linear};
+    const Map map{x0, x1, n, Linear};
+
+    // inside, same as the map; outside, zero, boundary value or linear continuation
+    std::mt19937_64 rng{1};
+    std::uniform_real_distribution<double> u{-1, 1};
+    auto zeroOk{true};
+    auto clampDiff{0.};
+    auto extrapolateDiff{0.};
+    for (int i{}; i < 10000; ++i) {
+        const Eigen::Vector3d x{2 * u(rng), 4 * u(rng), 6 * u(rng)};
+        const auto inside{std::abs(x[0]) <= 1 and std::abs(x[1]) <= 2 and std::abs(x[2]) <= 3};
+        const Eigen::Vector3d xc{std::clamp(x[0], -1., 1.), std::clamp(x[1], -2., 2.), std::clamp(x[2], -3., 3.)};
+        zeroOk = zeroOk and zero.Contains(x) == inside and
+                 (inside ? zero.B(x) == map.B(x) : zero.B(x) == Eigen::Vector3d::Zero());
+        clampDiff = std::max(clampDiff, (clamp.B(x) - map.B(xc)).cwiseAbs().maxCoeff());
+        extrapolateDiff = std::max(extrapolateDiff, (extrapolate.B(x) - Linear(x[0], x[1], x[2])).cwiseAbs().maxCoeff());
+    }
+    std::cout << "Zero: " << zeroOk << ", Clamp: max diff = " << clampDiff << ", Extrapolate (linear field): max diff = " << extrapolateDiff << '\n';
+    ok = ok and zeroOk and clampDiff < 1e-14 and extrapolateDiff < 1e-12;
+
+    // oriented box around an analytic field
+    const Eigen::Transform<double, 3, Eigen::Isometry> box{Eigen::Translation3d{5, 0, 0} * Eigen::AngleAxisd{0.5, Eigen::Vector3d::UnitZ()}};
+    const BoundedField<UniformElectromagneticField> oriented{box, muc::array3d{-1, -1, -1}, muc::array3d{1, 1, 1}, muc::array3d{0, 0, 1}, muc::array3d{1, 0, 0}};
+    auto orientedOk{true};
+    for (int i{}; i < 10000; ++i) {
+        const Eigen::Vector3d xb{1.5 * u(rng), 1.5 * u(rng), 1.5 * u(rng)};
+        const auto inside{xb.cwiseAbs().maxCoeff() <= 1};
+        const Eigen::Vector3d x{box * xb};
+        const auto [b, e]{oriented.BE(x)};
+        orientedOk = orientedOk and oriented.Contains(x) == inside and (b[2] == (inside ? 1 : 0)) and (e[0] == (inside ? 1 : 0));
+    }
+    std::cout << "Oriented box: " << orientedOk << '\n';
+    ok = ok and orientedOk;
+
+    // flat or inverted boxes are rejected
+    const auto Throws{[&](auto&& Construct) {
+        try {
+            Construct();
+        } catch (const std::invalid_argument&) { return true; }
+        return false;
+    }};
+    const auto degenerateRejected{Throws([] { BoundedField<UniformElectricField, "Extrapolate">{muc::array3d{-1, 0, -1}, muc::array3d{1, 0, 1}, muc::array3d{1, 0, 0}}; }) and
+                                  Throws([&] { BoundedField<UniformElectricField>{box, muc::array3d{1, -1, -1}, muc::array3d{-1, 1, 1}, muc::array3d{1, 0, 0}}; })};
+    std::cout << "Degenerate box rejected: " << degenerateRejected << '\n';
+    ok = ok and degenerateRejected;
+
+    // Geant4 gets zero outside without evaluating the field
+    const AsG4Field<FieldSuperposition<BoundedField<Map>, BoundedField<Map>>> g4Field{
+        BoundedField<Map>{x0, x1, x0, x1, n, Linear}, BoundedField<Map>{{9, -2, -3}, {11, 2, 3}, muc::array3d{9, -2, -3}, muc::array3d{11, 2, 3}, n, Linear}};
+    G4double b[3];
+    const G4double outside[4]{5, 0, 0, 0};
+    g4Field.GetFieldValue(outside, b);
+    const G4double inside[4]{10, 0.5, 0.5, 0};
+    const auto expected{Linear(10, 0.5, 0.5)};
+    auto g4Ok{b[0] == 0 and b[1] == 0 and b[2] == 0};
+    g4Field.GetFieldValue(inside, b);
+    g4Ok = g4Ok and (Eigen::Vector3d{b[0], b[1], b[2]} - expected).cwiseAbs().maxCoeff() < 1e-12;
+    // electric and electromagnetic fields: B and E are both zeroed outside
+    const AsG4Field<BoundedField<UniformElectricField>> g4Electric{x0, x1, 0, 0, 1};
+    const AsG4Field<BoundedField<UniformElectromagneticField>> g4EM{x0, x1, 1, 2, 3, 4, 5, 6};
+    for (const G4Field* field : std::initializer_list<const G4Field*>{&g4Electric, &g4EM}) {
+        G4double be[6];
+        const G4double origin[4]{0, 0, 0, 0};
+        field->GetFieldValue(origin, be);
+        g4Ok = g4Ok and be[5] != 0;
+        field->GetFieldValue(outside, be);
+        g4Ok = g4Ok and std::ranges::all_of(be, [](auto v) { return v == 0; });
+    }
+    std::cout << "AsG4Field: " << g4Ok << '\n';
+    ok = ok and g4Ok;
+
+    // cost of a query outside the region
+    std::vector<muc::array3d> far(1 << 20);
+    for (auto&& x : far) { x = {100 + u(rng), 100 * u(rng), 100 * u(rng)}; }
+    double sum{};
+    muc::wall_time_stopwatch<> stopwatch;
+    for (auto&& x : far) { sum += map.B(x)[1]; }
+    const auto mapTime{stopwatch.ms_elapsed()};
+    stopwatch = {};
+    for (auto&& x : far) { sum += zero.B(x)[1]; }
+    const auto zeroTime{stopwatch.ms_elapsed()};
+    stopwatch = {};
+    for (auto&& x : far) {
+        G4double point[4]{x[0], x[1], x[2], 0};
+        g4Field.GetFieldValue(point, b);
+        sum += b[1];
+    }
+    const auto g4Time{stopwatch.ms_elapsed()};
+    std::cout << "outside: map " << mapTime * 1e6 / far.size() << " ns/eval, bounded " << zeroTime * 1e6 / far.size()
+              << " ns/eval, AsG4Field of 2 bounded maps " << g4Time * 1e6 / far.size() << " ns/eval (checksum " << sum << ")\n";
+
+    std::cout << (ok ? "Passed" : "Failed") << std::endl;
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
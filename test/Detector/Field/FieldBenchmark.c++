@@ -0,0 +1,336 @@
+#include "Mustard/Detector/Field/AsG4Field.h++"
+#include "Mustard/Detector/Field/ElectromagneticFieldMap.h++"
+#include "Mustard/Detector/Field/FieldMapSymmetry.h++"
+#include "Mustard/Detector/Field/GridFieldMap3D.h++"
+#include "Mustard/Detector/Field/MagneticFieldMap.h++"
+#include "Mustard/Detector/Field/ToroidField.h++"
+#include "Mustard/Detector/Field/UniformMagneticField.h++"
+#include "Mustard/Utility/InlineMacro.h++"
+
+#include "Eigen/Core"
+
+#include "fmt/format.h"
+
+#include "muc/array"
+#include "muc/ceta_string"
+#include "muc/functional"
+#include "muc/time"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <optional>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined __linux__
+#    include "linux/perf_event.h"
+#    include "sys/ioctl.h"
+#    include "sys/syscall.h"
+#    include "unistd.h"
+#endif
+
+// Field evaluation micro-benchmark. Prints one JSON object per line and case:
+//   field, size, pattern, call: what is measured
+//   nsPerEval: best of several sweeps over the query points
+//   footprintBytes: node memory of a map (null for analytic fields)
+//   newCellRate: fraction of queries in another grid cell than the previous query, a proxy for
+//                node cache line reuse (null for analytic fields)
+//   cacheMissPerEval, l1dMissPerEval: hardware counters (null if perf events are unavailable)
+// Maps are GridFieldMap3D sampled in-process, "small" fits in L1/L2 and "large" exceeds the LLC.
+// Usage: FieldBenchmark [name filter] > result.jsonl
+
+using namespace Mustard::Detector::Field;
+
+namespace {
+
+constexpr auto gNPoint{1 << 18};
+constexpr auto gNSweep{5};
+constexpr auto gHalfSize{1.};
+
+struct Grid {
+    std::string_view size;
+    int n;
+};
+
+constexpr std::array gGrid{Grid{"small", 12}, Grid{"large", 160}};
+
+auto Synthetic(double x, double y, double z) -> Eigen::Vector<double, 6> {
+    return {std::sin(x + 0.3 * y), std::cos(y - 0.2 * z), 1 + 0.5 * std::sin(z * x),
+            std::cos(x * y), std::sin(z + x), 0.1 * y};
+}
+
+// Query patterns, all in [-1, 1]^3
+auto RandomPattern(std::mt19937_64& rng) -> std::vector<muc::array3d> {
+    std::uniform_real_distribution<double> u{-gHalfSize, gHalfSize};
+    std::vector<muc::array3d> point(gNPoint);
+    for (auto&& x : point) { x = {u(rng), u(rng), u(rng)}; }
+    return point;
+}
+
+// Helical tracks sampled like a classical RK4 step: start, midpoint twice, end
+auto RKPattern(std::mt19937_64& rng) -> std::vector<muc::array3d> {
+    std::uniform_real_distribution<double> u{-0.6, 0.6};
+    constexpr auto radius{0.3};
+    constexpr auto step{0.01};
+    constexpr auto nStep{200};
+    std::vector<muc::array3d> point;
+    point.reserve(gNPoint);
+    while (point.size() < gNPoint) {
+        const muc::array3d c{u(rng), u(rng), u(rng)};
+        const auto Helix{[&](double s) -> muc::array3d {
+            return {c[0] + radius * std::cos(s / radius), c[1] + radius * std::sin(s / radius), c[2] + 0.2 * s};
+        }};
+        for (int k{}; k < nStep and point.size() < gNPoint; ++k) {
+            const auto s{k * step};
+            for (auto&& ds : {0., step / 2, step / 2, step}) {
+                if (point.size() < gNPoint) { point.push_back(Helix(s + ds)); }
+            }
+        }
+    }
+    return point;
+}
+
+// Straight lines through the volume
+auto LinePattern(std::mt19937_64& rng) -> std::vector<muc::array3d> {
+    std::uniform_real_distribution<double> u{-gHalfSize, gHalfSize};
+    std::normal_distribution<double> g;
+    constexpr auto step{0.005};
+    constexpr auto nStep{400};
+    std::vector<muc::array3d> point;
+    point.reserve(gNPoint);
+    while (point.size() < gNPoint) {
+        const Eigen::Vector3d x0{u(rng), u(rng), u(rng)};
+        const Eigen::Vector3d d{Eigen::Vector3d{g(rng), g(rng), g(rng)}.normalized()};
+        for (int k{}; k < nStep and point.size() < gNPoint; ++k) {
+            const Eigen::Vector3d x{x0 + (k - nStep / 2) * step * d};
+            point.push_back({x[0], x[1], x[2]});
+        }
+    }
+    return point;
+}
+
+struct MapInfo {
+    std::size_t footprint;
+    int n;
+    std::array<bool, 3> mirror; // axes folded by a coordinate symmetry, covered by [0, 1]
+};
+
+auto NewCellRate(const std::vector<muc::array3d>& point, const MapInfo& map) -> double {
+    const auto Cell{[&](const muc::array3d& x) {
+        std::array<int, 3> index;
+        for (int i{}; i < 3; ++i) {
+            const auto u{map.mirror[i] ? std::abs(x[i]) / gHalfSize : (x[i] + gHalfSize) / (2 * gHalfSize)};
+            index[i] = std::clamp(static_cast<int>(u * (map.n - 1)), 0, map.n - 2);
+        }
+        return index;
+    }};
+    std::size_t nNew{};
+    for (std::size_t i{1}; i < point.size(); ++i) { nNew += Cell(point[i]) != Cell(point[i - 1]); }
+    return static_cast<double>(nNew) / (point.size() - 1);
+}
+
+// A real virtual call, as from Geant4
+MUSTARD_NOINLINE auto GetFieldValue(const G4Field& field, const muc::array3d& x, double t, G4double* f) -> void {
+    const G4double point[4]{x[0], x[1], x[2], t};
+    field.GetFieldValue(point, f);
+}
+
+// Hardware counters through perf_event_open, if the kernel lets us
+class PerfCounter {
+public:
+    PerfCounter(std::uint32_t type, std::uint64_t config) :
+        fFD{-1} {
+#if defined __linux__
+        perf_event_attr attribute{};
+        attribute.type = type;
+        attribute.size = sizeof(attribute);
+        attribute.config = config;
+        attribute.disabled = 1;
+        attribute.exclude_kernel = 1;
+        attribute.exclude_hv = 1;
+        fFD = static_cast<int>(syscall(SYS_perf_event_open, &attribute, 0, -1, -1, 0));
+#endif
+    }
+    ~PerfCounter() {
+#if defined __linux__
+        if (fFD >= 0) { close(fFD); }
+#endif
+    }
+    PerfCounter(const PerfCounter&) = delete;
+    auto operator=(const PerfCounter&) -> PerfCounter& = delete;
+
+    auto Start() -> void {
+#if defined __linux__
+        if (fFD < 0) { return; }
+        ioctl(fFD, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fFD, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+    auto Stop() -> std::optional<std::uint64_t> {
+#if defined __linux__
+        if (fFD < 0) { return std::nullopt; }
+        ioctl(fFD, PERF_EVENT_IOC_DISABLE, 0);
+        std::uint64_t count;
+        if (read(fFD, &count, sizeof(count)) != sizeof(count)) { return std::nullopt; }
+        return count;
+#else
+        return std::nullopt;
+#endif
+    }
+
+private:
+    int fFD;
+};
+
+class Benchmark {
+public:
+    Benchmark(std::string_view filter) :
+        fFilter{filter},
+        fPattern{},
+#if defined __linux__
+        fCacheMiss{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+        fL1DMiss{PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+#else
+        fCacheMiss{0, 0},
+        fL1DMiss{0, 0},
+#endif
+        fSink{} {
+        std::mt19937_64 rng{20240601};
+        fPattern.push_back({"random", RandomPattern(rng)});
+        fPattern.push_back({"rk", RKPattern(rng)});
+        fPattern.push_back({"line", LinePattern(rng)});
+    }
+
+    auto Sink() const -> double { return fSink; }
+
+    /// @brief Runs Eval(x) -> double on every pattern.
+    template<typename AEval>
+    auto Run(std::string_view field, std::string_view size, std::string_view call, AEval&& Eval,
+             std::optional<MapInfo> map = std::nullopt) -> void {
+        if (not fFilter.empty() and field.find(fFilter) == std::string_view::npos) { return; }
+        for (auto&& [pattern, point] : fPattern) {
+            auto sum{0.};
+            for (auto&& x : point) { sum += Eval(x); } // warm up
+            auto best{std::numeric_limits<double>::max()};
+            for (int sweep{}; sweep < gNSweep; ++sweep) {
+                muc::wall_time_stopwatch<> stopwatch;
+                for (auto&& x : point) { sum += Eval(x); }
+                best = std::min(best, stopwatch.ms_elapsed());
+            }
+            fCacheMiss.Start();
+            fL1DMiss.Start();
+            for (auto&& x : point) { sum += Eval(x); }
+            const auto l1dMiss{fL1DMiss.Stop()};
+            const auto cacheMiss{fCacheMiss.Stop()};
+            fSink += sum;
+
+            const auto PerEval{[&](std::optional<std::uint64_t> count) {
+                return count ? fmt::format("{:.4f}", static_cast<double>(*count) / point.size()) : "null";
+            }};
+            const auto footprint{map ? fmt::format("{}", map->footprint) : "null"};
+            const auto newCellRate{map ? fmt::format("{:.4f}", NewCellRate(point, *map)) : "null"};
+            std::printf("%s\n", fmt::format(R"({{"field": "{}", "size": "{}", "pattern": "{}", "call": "{}", "nsPerEval": {:.3f}, "footprintBytes": {}, "newCellRate": {}, "cacheMissPerEval": {}, "l1dMissPerEval": {}}})",
+                                            field, size, pattern, call, best * 1e6 / point.size(), footprint, newCellRate, PerEval(cacheMiss), PerEval(l1dMiss))
+                                    .c_str());
+            std::fflush(stdout);
+        }
+    }
+
+private:
+    struct Pattern {
+        std::string_view name;
+        std::vector<muc::array3d> point;
+    };
+
+private:
+    std::string_view fFilter;
+    std::vector<Pattern> fPattern;
+    PerfCounter fCacheMiss;
+    PerfCounter fL1DMiss;
+    double fSink;
+};
+
+template<typename ACoordinateTransform, typename AFieldTransform>
+auto RunMagneticFieldMap(Benchmark& benchmark, std::string_view field) -> void {
+    using Map = MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d, ACoordinateTransform, AFieldTransform>>;
+    // symmetric maps cover the non-negative half of each mirrored axis with the same number of nodes
+    constexpr auto Mirrored{[](auto... symmetry) { return (... or std::same_as<ACoordinateTransform, decltype(symmetry)>); }};
+    constexpr std::array mirror{Mirrored(CoordinateSymmetryX{}, CoordinateSymmetryXY{}, CoordinateSymmetryXZ{}, CoordinateSymmetryXYZ{}),
+                                Mirrored(CoordinateSymmetryY{}, CoordinateSymmetryXY{}, CoordinateSymmetryYZ{}, CoordinateSymmetryXYZ{}),
+                                Mirrored(CoordinateSymmetryZ{}, CoordinateSymmetryXZ{}, CoordinateSymmetryYZ{}, CoordinateSymmetryXYZ{})};
+    const muc::array3d x0{mirror[0] ? 0 : -gHalfSize, mirror[1] ? 0 : -gHalfSize, mirror[2] ? 0 : -gHalfSize};
+    const muc::array3d x1{gHalfSize, gHalfSize, gHalfSize};
+    for (auto&& [size, n] : gGrid) {
+        const Map map{x0, x1, {n, n, n}, [](double x, double y, double z) -> Eigen::Vector3d { return Synthetic(x, y, z).head<3>(); }};
+        benchmark.Run(field, size, "B", [&](const muc::array3d& x) { return map.B(x)[1]; },
+                      MapInfo{map.Node().size_bytes(), n, mirror});
+    }
+}
+
+template<muc::ceta_string ACache>
+auto RunElectromagneticFieldMap(Benchmark& benchmark) -> void {
+    using Map = ElectromagneticFieldMap<ACache, GridFieldMap3D<Eigen::Vector<double, 6>>>;
+    const auto field{fmt::format("ElectromagneticFieldMap<{}>", std::string_view{ACache})};
+    for (auto&& [size, n] : gGrid) {
+        const Map map{muc::array3d{-gHalfSize, -gHalfSize, -gHalfSize}, muc::array3d{gHalfSize, gHalfSize, gHalfSize}, std::array{n, n, n}, Synthetic};
+        const MapInfo info{map.Node().size_bytes(), n, {}};
+        benchmark.Run(field, size, "BE", [&](const muc::array3d& x) {
+            const auto [b, e]{map.BE(x)};
+            return b[1] + e[1]; }, info);
+        // the case a cache is for: B and E at the same point
+        benchmark.Run(field, size, "B,E", [&](const muc::array3d& x) { return map.B(x)[1] + map.E(x)[1]; }, info);
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Benchmark benchmark{argc > 1 ? argv[1] : ""};
+
+    const UniformMagneticField uniform{0, 0, 1};
+    benchmark.Run("UniformMagneticField", "-", "B", [&](const muc::array3d& x) { return uniform.B(x)[2]; });
+    const ToroidField toroid{1, 0.5, Eigen::Vector3d{0, 0, 0}, Eigen::Vector3d{0, 0, 1}};
+    benchmark.Run("ToroidField", "-", "B", [&](const muc::array3d& x) { return toroid.B(x)[1]; });
+
+    RunMagneticFieldMap<muc::multidentity, EFM::Identity>(benchmark, "MagneticFieldMap");
+    RunMagneticFieldMap<CoordinateSymmetryX, FieldSymmetryX>(benchmark, "MagneticFieldMapSymmetryX");
+    RunMagneticFieldMap<CoordinateSymmetryY, FieldSymmetryY>(benchmark, "MagneticFieldMapSymmetryY");
+    RunMagneticFieldMap<CoordinateSymmetryZ, FieldSymmetryZ>(benchmark, "MagneticFieldMapSymmetryZ");
+    RunMagneticFieldMap<CoordinateSymmetryXY, FieldSymmetryXY>(benchmark, "MagneticFieldMapSymmetryXY");
+    RunMagneticFieldMap<CoordinateSymmetryXZ, FieldSymmetryXZ>(benchmark, "MagneticFieldMapSymmetryXZ");
+    RunMagneticFieldMap<CoordinateSymmetryYZ, FieldSymmetryYZ>(benchmark, "MagneticFieldMapSymmetryYZ");
+    RunMagneticFieldMap<CoordinateSymmetryXYZ, FieldSymmetryXYZ>(benchmark, "MagneticFieldMapSymmetryXYZ");
+
+    RunElectromagneticFieldMap<"WithCache">(benchmark);
+    RunElectromagneticFieldMap<"NoCache">(benchmark);
+    RunElectromagneticFieldMap<"CellCache">(benchmark);
+
+    // through the Geant4 interface: virtual call, (x, y, z, t) in and a G4double array out
+    const AsG4Field<UniformMagneticField> g4Uniform{0, 0, 1};
+    benchmark.Run("AsG4Field<UniformMagneticField>", "-", "GetFieldValue", [&](const muc::array3d& x) {
+        G4double b[3];
+        GetFieldValue(g4Uniform, x, 0, b);
+        return b[2]; });
+    for (auto&& [size, n] : gGrid) {
+        const AsG4Field<MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d>>> g4Map{
+            muc::array3d{-gHalfSize, -gHalfSize, -gHalfSize}, muc::array3d{gHalfSize, gHalfSize, gHalfSize}, std::array{n, n, n},
+            [](double x, double y, double z) -> Eigen::Vector3d { return Synthetic(x, y, z).head<3>(); }};
+        benchmark.Run("AsG4Field<MagneticFieldMap>", size, "GetFieldValue", [&](const muc::array3d& x) {
+            G4double b[3];
+            GetFieldValue(g4Map, x, 0, b);
+            return b[1]; }, MapInfo{g4Map.Node().size_bytes(), n, {}});
+    }
+
+    std::fprintf(stderr, "checksum %g\n", benchmark.Sink());
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,216 @@
+#include "Mustard/Detector/Field/ElectromagneticFieldMap.h++"
+#include "Mustard/Detector/Field/FieldMapSymmetry.h++"
+#include "Mustard/Detector/Field/GridFieldMap3D.h++"
+#include "Mustard/Detector/Field/MagneticFieldMap.h++"
+#include "Mustard/Detector/Field/ToroidField.h++"
+#include "Mustard/Math/BFloat16.h++"
+#include "Mustard/Math/Float16.h++"
+
+#include "Eigen/Core"
+
+#include "muc/array"
+#include "muc/time"
+
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <span>
+#include <vector>
+
+using namespace Mustard;
+using namespace Mustard::Detector::Field;
+
+// trilinear interpolation is exact for fields linear in each coordinate
+auto Linear(double x, double y, double z) -> Eigen::Vector3d {
+    return {1 + 2 * x - y, 3 * y + x * z, -z + 0.5 * x * y * z};
+}
+
+// solenoid-like, with a magnitude beyond the Float16 range to exercise the scale
+auto Solenoid(double x, double y, double z) -> Eigen::Vector3d {
+    const auto b{1e5 / (1 + 4 * z * z)};
+    return {4 * x * z * b / (1 + 4 * z * z), 4 * y * z * b / (1 + 4 * z * z), b};
+}
+
+template<typename AField>
+auto MaxDifference(const AField& field, const std::vector<muc::array3d>& x, const std::vector<muc::array3d>& b) -> double {
+    double maxDiff{};
+    for (std::size_t i{}; i < x.size(); ++i) {
+        const auto bi{field.B(x[i])};
+        for (int c{}; c < 3; ++c) { maxDiff = std::max(maxDiff, std::abs(bi[c] - b[i][c])); }
+    }
+    return maxDiff;
+}
+
+// compares a map with reduced-precision storage to the double map, against the documented bound
+template<typename AStorage>
+auto CompareStorage(const char* name, double bound, const std::vector<muc::array3d>& x, const std::vector<muc::array3d>& reference, const muc::array3d& m) -> bool {
+    const MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d, muc::multidentity, EFM::Identity, AStorage>> map{{-1, -1, -1}, {1, 1, 1}, {201, 201, 201}, Solenoid};
+    std::vector<muc::array3d> b(x.size());
+    muc::wall_time_stopwatch<> stopwatch;
+    map.template BatchB<muc::array3d>(x, b);
+    const auto time{stopwatch.ms_elapsed()};
+    // the component maximum M over the grid bounds the largest corner magnitude F of any cell
+    auto maxRelativeDiff{0.};
+    for (std::size_t i{}; i < x.size(); ++i) {
+        for (int c{}; c < 3; ++c) { maxRelativeDiff = std::max(maxRelativeDiff, std::abs(b[i][c] - reference[i][c]) / m[c]); }
+    }
+    std::cout << name << ": " << map.Node().size() * sizeof(AStorage) / 1e6 << " MB, "
+              << time * 1e6 / x.size() << " ns/eval (batch), max |diff| / M = " << maxRelativeDiff << " (bound " << bound << ")\n";
+    return maxRelativeDiff <= bound;
+}
+
+int main() {
+    auto ok{true};
+
+    std::mt19937_64 random;
+    std::uniform_real_distribution<double> uniform{-1, 1};
+    std::vector<muc::array3d> x(1'000'000);
+    for (auto&& xi : x) { xi = {uniform(random), uniform(random), uniform(random)}; }
+    std::vector<muc::array3d> b(x.size());
+
+    // plain grid (large enough for blocked batch interpolation): scalar and batch agree with the analytic field
+    const MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d>> map{{-1, -1, -1}, {1, 1, 1}, {81, 81, 81}, Linear};
+    map.BatchB<muc::array3d>(x, b);
+    double maxDiff{};
+    for (std::size_t i{}; i < x.size(); ++i) {
+        const auto exact{Linear(x[i][0], x[i][1], x[i][2])};
+        for (int c{}; c < 3; ++c) { maxDiff = std::max(maxDiff, std::abs(exact[c] - b[i][c])); }
+    }
+    const auto scalarDiff{MaxDifference(map, x, b)};
+    std::cout << "GridFieldMap3D: max |batch - exact| = " << maxDiff << ", max |batch - scalar| = " << scalarDiff << '\n';
+    ok = ok and maxDiff < 1e-12 and scalarDiff < 1e-12;
+
+    // mirror symmetric grid, stored on x >= 0 only
+    const MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d, CoordinateSymmetryX, FieldSymmetryX>> mapX{
+        {0, -1, -1}, {1, 1, 1}, {41, 81, 81}, [](double x, double y, double z) -> Eigen::Vector3d { return {x * y, y, z}; }};
+    mapX.BatchB<muc::array3d>(x, b);
+    maxDiff = 0;
+    for (std::size_t i{}; i < x.size(); ++i) {
+        const auto [x0, y0, z0]{x[i]};
+        const muc::array3d exact{x0 * y0, y0, z0};
+        for (int c{}; c < 3; ++c) { maxDiff = std::max(maxDiff, std::abs(exact[c] - b[i][c])); }
+    }
+    const auto scalarDiffX{MaxDifference(mapX, x, b)};
+    std::cout << "GridFieldMap3D (symmetry X): max |batch - exact| = " << maxDiff << ", max |batch - scalar| = " << scalarDiffX << '\n';
+    ok = ok and maxDiff < 1e-12 and scalarDiffX < 1e-12;
+
+    // generic fallback
+    const ToroidField toroid{1, 0.5, Eigen::Vector3d{0, 0, 0}, Eigen::Vector3d{0, 0, 1}};
+    toroid.BatchB<muc::array3d>(x, b);
+    const auto toroidDiff{MaxDifference(toroid, x, b)};
+    std::cout << "ToroidField: max |batch - scalar| = " << toroidDiff << '\n';
+    ok = ok and toroidDiff == 0;
+
+    // reduced-precision storage
+    const MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d>> solenoid{{-1, -1, -1}, {1, 1, 1}, {201, 201, 201}, Solenoid};
+    std::vector<muc::array3d> reference(x.size());
+    muc::wall_time_stopwatch<> stopwatch;
+    solenoid.BatchB<muc::array3d>(x, reference);
+    std::cout << "double: " << solenoid.Node().size() * sizeof(double) / 1e6 << " MB, "
+              << stopwatch.ms_elapsed() * 1e6 / x.size() << " ns/eval (batch)\n";
+    muc::array3d m{};
+    for (std::size_t i{}; i < solenoid.Node().size(); ++i) { m[i % 3] = std::max(m[i % 3], std::abs(solenoid.Node()[i])); }
+    ok = CompareStorage<float>("float", std::pow(2, -24), x, reference, m) and ok;
+    ok = CompareStorage<Math::BFloat16>("BFloat16", std::pow(2, -8), x, reference, m) and ok;
+    ok = CompareStorage<Math::Float16>("Float16", std::pow(2, -11) + std::pow(2, -25), x, reference, m) and ok;
+
+    // binary field map file: a mapped map interpolates exactly as the saved one
+    const auto file{std::filesystem::temp_directory_path() / "MustardTestGridFieldMap3D.mfm"};
+    using Float16Map = MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d, muc::multidentity, EFM::Identity, Math::Float16>>;
+    const Float16Map saved{{-1, -1, -1}, {1, 1, 1}, {201, 201, 201}, Solenoid};
+    saved.Save(file, "m", "T");
+    muc::wall_time_stopwatch<> loadStopwatch;
+    const Float16Map loaded{file, "m", "T"};
+    const auto loadTime{loadStopwatch.ms_elapsed()};
+    saved.BatchB<muc::array3d>(x, reference);
+    const auto loadedDiff{MaxDifference(loaded, x, reference)};
+    std::cout << "Float16 file: " << std::filesystem::file_size(file) / 1e6 << " MB, mapped in " << loadTime << " ms, max |loaded - saved| = " << loadedDiff << '\n';
+    ok = ok and loadedDiff == 0;
+    const auto Throws{[&](auto&& Load) {
+        try {
+            Load();
+        } catch (const std::runtime_error&) { return true; }
+        return false;
+    }};
+    const auto mismatchRejected{Throws([&] { Float16Map{file, "mm", "T"}; }) and
+                                Throws([&] { MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d>>{file, "m", "T"}; }) and
+                                Throws([&] { MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d, CoordinateSymmetryX, FieldSymmetryX, Math::Float16>>{file, "m", "T"}; })};
+    // flip one node byte
+    if (const auto stream{std::fopen(file.generic_string().c_str(), "r+b")}) {
+        std::fseek(stream, -1, SEEK_END);
+        const auto byte{std::fgetc(stream)};
+        std::fseek(stream, -1, SEEK_END);
+        std::fputc(byte ^ 1, stream);
+        std::fclose(stream);
+    }
+    const auto corruptionDetected{not Throws([&] { Float16Map{file, "m", "T"}; }) and Throws([&] { Float16Map{file, "m", "T", true}; })};
+    std::filesystem::remove(file);
+    std::cout << "Float16 file: mismatch rejected: " << mismatchRejected << ", corruption detected on verification: " << corruptionDetected << '\n';
+    ok = ok and mismatchRejected and corruptionDetected;
+
+    // cell cache: RK-like queries, several points per cell; also from several threads sharing one map
+    using Vector6d = Eigen::Vector<double, 6>;
+    using Float16Grid6D = GridFieldMap3D<Vector6d, muc::multidentity, EFM::Identity, Math::Float16>;
+    const auto Field6D{[](double x, double y, double z) -> Vector6d {
+        const auto b{Solenoid(x, y, z)};
+        return (Vector6d{} << b, 1e3 * x, 1e3 * y, 1e3 * z).finished();
+    }};
+    const ElectromagneticFieldMap<"CellCache", Float16Grid6D> cellCached{{-1, -1, -1}, {1, 1, 1}, {201, 201, 201}, Field6D};
+    const ElectromagneticFieldMap<"NoCache", Float16Grid6D> noCache{{-1, -1, -1}, {1, 1, 1}, {201, 201, 201}, Field6D};
+    std::vector<muc::array3d> step(x.size());
+    for (std::size_t i{}; i < x.size(); ++i) {
+        // 6 stages along a 1/4-cell step
+        const auto& x0{x[i / 6 * 6]};
+        const auto t{static_cast<double>(i % 6) / 5 * 0.0025};
+        step[i] = {x0[0] + t, x0[1] + t, x0[2] + t};
+    }
+    const auto Evaluate{[&](auto&& field, std::size_t begin, std::size_t end, std::vector<muc::array3d>& b, std::vector<muc::array3d>& e) {
+        for (std::size_t i{begin}; i < end; ++i) {
+            const auto [bi, ei]{field.template BE<muc::array3d>(step[i])};
+            b[i] = bi;
+            e[i] = ei;
+        }
+    }};
+    std::vector<muc::array3d> bCached(x.size());
+    std::vector<muc::array3d> eCached(x.size());
+    std::vector<muc::array3d> eNoCache(x.size());
+    stopwatch = {};
+    Evaluate(noCache, 0, x.size(), b, eNoCache);
+    const auto noCacheTime{stopwatch.ms_elapsed()};
+    stopwatch = {};
+    Evaluate(cellCached, 0, x.size(), bCached, eCached);
+    const auto cellCacheTime{stopwatch.ms_elapsed()};
+    auto cellCacheAgrees{bCached == b and eCached == eNoCache};
+    std::ranges::fill(bCached, muc::array3d{});
+    {
+        std::vector<std::jthread> thread;
+        for (std::size_t t{}; t < 4; ++t) {
+            thread.emplace_back([&, t] { Evaluate(cellCached, t * x.size() / 4, (t + 1) * x.size() / 4, bCached, eCached); });
+        }
+    }
+    cellCacheAgrees = cellCacheAgrees and bCached == b and eCached == eNoCache;
+    std::cout << "Float16 6D, RK-like: CellCache " << cellCacheTime * 1e6 / x.size() << " ns/eval, NoCache " << noCacheTime * 1e6 / x.size()
+              << " ns/eval, identical (also with 4 threads): " << cellCacheAgrees << '\n';
+    ok = ok and cellCacheAgrees;
+
+    // timing, with a cache-resident and a memory-bound grid
+    for (auto n : {21, 201}) {
+        const MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d>> timedMap{{-1, -1, -1}, {1, 1, 1}, {n, n, n}, Linear};
+        muc::wall_time_stopwatch<> stopwatch;
+        for (std::size_t i{}; i < x.size(); ++i) { b[i] = timedMap.B(x[i]); }
+        const auto scalarTime{stopwatch.ms_elapsed()};
+        stopwatch = {};
+        timedMap.BatchB<muc::array3d>(x, b);
+        const auto batchTime{stopwatch.ms_elapsed()};
+        std::cout << n << "^3 grid:\n"
+                  << "    point-by-point : " << scalarTime * 1e6 / x.size() << " ns/eval\n"
+                  << "    batch          : " << batchTime * 1e6 / x.size() << " ns/eval (speedup: " << scalarTime / batchTime << ")\n";
+    }
+
+    std::cout << (ok ? "Passed" : "Failed") << std::endl;
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,78 @@
+#include "Mustard/Detector/Field/GridFieldMap3D.h++"
+#include "Mustard/Detector/Field/MagneticFieldMap.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Math/Float16.h++"
+
+#include "Eigen/Core"
+
+#include "mpi.h"
+
+#include "muc/array"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Mustard;
+using namespace Mustard::Detector::Field;
+
+auto Linear(double x, double y, double z) -> Eigen::Vector3d {
+    return {1 + 2 * x - y, 3 * y + x * z, -z + 0.5 * x * y * z};
+}
+
+// a node-shared map must interpolate exactly like the same map held by each process
+template<typename AStorage>
+auto Compare(const char* name, int& nSample) -> bool {
+    using Map = MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d, muc::multidentity, EFM::Identity, AStorage>>;
+    const auto Count{[&](double x, double y, double z) {
+        ++nSample;
+        return Linear(x, y, z);
+    }};
+    const Map local{{-1, -1, -1}, {1, 1, 1}, {21, 31, 41}, Linear};
+    const Map shared{NodeShared{}, {-1, -1, -1}, {1, 1, 1}, {21, 31, 41}, Count};
+    auto ok{shared.Node().size() == local.Node().size() and shared.Scale() == local.Scale()};
+    std::mt19937_64 random;
+    std::uniform_real_distribution<double> uniform{-1.2, 1.2};
+    for (int i{}; i < 10000; ++i) {
+        const muc::array3d x{uniform(random), uniform(random), uniform(random)};
+        ok = ok and shared.B(x) == local.B(x);
+    }
+    if (not ok) { std::cout << name << ": node-shared map differs from local map\n"; }
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    Env::MPIEnv env{argc, argv, {}};
+
+    auto ok{true};
+
+    // only node master samples the field
+    int nSample{};
+    ok = Compare<double>("double", nSample) and ok;
+    ok = Compare<Math::Float16>("Float16", nSample) and ok;
+    if (nSample != (env.OnCommNodeMaster() ? 2 * 21 * 31 * 41 : 0)) {
+        std::cout << "Rank " << env.CommWorldRank() << " sampled " << nSample << " nodes\n";
+        ok = false;
+    }
+
+    // node values are significant on node master only
+    std::vector<Eigen::Vector3d> node;
+    if (env.OnCommNodeMaster()) { node.assign(2 * 2 * 2, {1, 2, 3}); }
+    const MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d>> uniform{NodeShared{}, {-1, -1, -1}, {1, 1, 1}, {2, 2, 2}, std::move(node)};
+    ok = ok and uniform.B(muc::array3d{0.1, 0.2, 0.3}) == muc::array3d{1, 2, 3};
+
+    // failure on node master is raised on all processes of the node
+    try {
+        node.clear();
+        const MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d>> wrong{NodeShared{}, {-1, -1, -1}, {1, 1, 1}, {2, 2, 2}, std::move(node)};
+        std::cout << "Rank " << env.CommWorldRank() << ": mismatched node count not detected\n";
+        ok = false;
+    } catch (const std::exception&) {}
+
+    auto allOk{ok};
+    MPI_Allreduce(&ok, &allOk, 1, MPI_CXX_BOOL, MPI_LAND, MPI_COMM_WORLD);
+    return allOk ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,103 @@
+#include "Mustard/Detector/Field/AsG4Field.h++"
+#include "Mustard/Detector/Field/ElectromagneticFieldMap.h++"
+#include "Mustard/Detector/Field/GridFieldMap3D.h++"
+#include "Mustard/Detector/Field/GridFieldMapRZ.h++"
+#include "Mustard/Detector/Field/MagneticFieldMap.h++"
+
+#include "CLHEP/Units/SystemOfUnits.h"
+
+#include "Eigen/Core"
+
+#include "muc/array"
+#include "muc/time"
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace Mustard::Detector::Field;
+
+// paraxial solenoid in SI units, (Br, Bphi, Bz)
+auto SolenoidRZ(double r, double z) -> Eigen::Vector3d {
+    const auto f{1 / (1 + z * z)};
+    return {r * z * f * f, 0, f};
+}
+
+auto Solenoid(double x, double y, double z) -> Eigen::Vector3d {
+    const auto bRZ{SolenoidRZ(std::hypot(x, y), z)};
+    const auto phi{std::atan2(y, x)};
+    return {bRZ[0] * std::cos(phi), bRZ[0] * std::sin(phi), bRZ[2]};
+}
+
+int main() {
+    auto ok{true};
+
+    std::mt19937_64 random;
+    std::uniform_real_distribution<double> uniform{-1, 1};
+    std::vector<muc::array3d> x(1'000'000);
+    for (auto&& xi : x) { xi = {uniform(random), uniform(random), uniform(random)}; }
+
+    // RZ map against the analytic field, and against a 3D map of the same resolution
+    const MagneticFieldMapRZ<> mapRZ{{0, -1}, {std::sqrt(2), 1}, {283, 201}, SolenoidRZ};
+    const MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d, muc::multidentity, BFieldSI2CLHEP<>>> map3D{{-1, -1, -1}, {1, 1, 1}, {201, 201, 201}, Solenoid};
+    double maxDiffRZ{};
+    double maxDiff3D{};
+    for (auto&& xi : x) {
+        const Eigen::Vector3d exact{Solenoid(xi[0], xi[1], xi[2]) * CLHEP::tesla};
+        const auto bRZ{mapRZ.B(xi)};
+        const auto b3D{map3D.B(xi)};
+        for (int c{}; c < 3; ++c) {
+            maxDiffRZ = std::max(maxDiffRZ, std::abs(bRZ[c] - exact[c]) / CLHEP::tesla);
+            maxDiff3D = std::max(maxDiff3D, std::abs(b3D[c] - exact[c]) / CLHEP::tesla);
+        }
+    }
+    std::cout << "RZ map: " << mapRZ.Node().size() * sizeof(Eigen::Vector3d) / 1e6 << " MB, max |B - exact| = " << maxDiffRZ << " T\n"
+              << "3D map: " << map3D.Node().size() * sizeof(double) / 1e6 << " MB, max |B - exact| = " << maxDiff3D << " T\n";
+    ok = ok and maxDiffRZ < 1e-4 and maxDiffRZ < 2 * maxDiff3D;
+
+    // on and near the axis: no transverse field on the axis, continuous towards it
+    double maxOnAxis{};
+    double maxNearAxis{};
+    for (auto z : {-0.9, -0.3, 0., 0.25, 0.7}) {
+        const auto b0{mapRZ.B(muc::array3d{0, 0, z})};
+        const auto b1{mapRZ.B(muc::array3d{1e-9, -1e-9, z})};
+        maxOnAxis = std::max({maxOnAxis, std::abs(b0[0]), std::abs(b0[1]), std::abs(b0[2] - SolenoidRZ(0, z)[2] * CLHEP::tesla)});
+        for (int c{}; c < 3; ++c) { maxNearAxis = std::max(maxNearAxis, std::abs(b1[c] - b0[c]) / CLHEP::tesla); }
+    }
+    std::cout << "on axis: max error = " << maxOnAxis << ", max |B(r = 1.4e-9) - B(0)| = " << maxNearAxis << " T\n";
+    ok = ok and maxOnAxis < 1e-12 and maxNearAxis < 1e-8;
+
+    // electromagnetic: radial E of a line charge, azimuthal B of a wire
+    const ElectromagneticFieldMapRZ<> emRZ{{0, -1}, {2, 1}, {101, 11}, [](double r, double) {
+                                               return (Eigen::Vector<double, 6>{} << 0, r, 0, 3 * r, 0, 0).finished();
+                                           }};
+    const auto [b, e]{emRZ.BE(muc::array3d{0.3, 0.4, 0.1})};
+    const auto emError{std::hypot(b[0] / CLHEP::tesla + 0.4, b[1] / CLHEP::tesla - 0.3, b[2]) +
+                       std::hypot(e[0] / (CLHEP::volt / CLHEP::m) - 0.9, e[1] / (CLHEP::volt / CLHEP::m) - 1.2, e[2])};
+    std::cout << "electromagnetic RZ map: error = " << emError << '\n';
+    ok = ok and emError < 1e-12;
+
+    // as a Geant4 field
+    const AsG4Field<MagneticFieldMapRZ<>> g4Field{{0, -1}, {std::sqrt(2), 1}, {283, 201}, SolenoidRZ};
+    const G4double point[4]{0.3, -0.2, 0.5, 0};
+    G4double g4B[3];
+    g4Field.GetFieldValue(point, g4B);
+    const auto bRZ{mapRZ.B(muc::array3d{0.3, -0.2, 0.5})};
+    const auto g4Agrees{g4B[0] == bRZ[0] and g4B[1] == bRZ[1] and g4B[2] == bRZ[2]};
+    std::cout << "AsG4Field<MagneticFieldMapRZ<>> agrees: " << g4Agrees << '\n';
+    ok = ok and g4Agrees;
+
+    // timing
+    std::vector<muc::array3d> result(x.size());
+    muc::wall_time_stopwatch<> stopwatch;
+    for (std::size_t i{}; i < x.size(); ++i) { result[i] = mapRZ.B(x[i]); }
+    const auto timeRZ{stopwatch.ms_elapsed()};
+    stopwatch = {};
+    for (std::size_t i{}; i < x.size(); ++i) { result[i] = map3D.B(x[i]); }
+    const auto time3D{stopwatch.ms_elapsed()};
+    std::cout << "RZ map: " << timeRZ * 1e6 / x.size() << " ns/eval, 3D map: " << time3D * 1e6 / x.size() << " ns/eval\n";
+
+    std::cout << (ok ? "Passed" : "Failed") << std::endl;
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,149 @@
+#include "Mustard/Detector/Field/BakeField.h++"
+#include "Mustard/Detector/Field/BoundedField.h++"
+#include "Mustard/Detector/Field/FieldSuperposition.h++"
+#include "Mustard/Detector/Field/GridFieldMap3D.h++"
+#include "Mustard/Detector/Field/MagneticFieldMap.h++"
+#include "Mustard/Detector/Field/PlacedField.h++"
+
+#include "Eigen/Core"
+#include "Eigen/Geometry"
+
+#include "muc/array"
+#include "muc/time"
+
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace Mustard::Detector::Field;
+
+using Map = MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d>>;
+using Magnet = PlacedField<BoundedField<Map>>;
+
+auto Dipole(double x, double y, double z) -> Eigen::Vector3d { return {0.1 * y * z, 1 / (1 + z * z) + 0.2 * x, 0}; }
+
+// a magnet of length 2 along its local z, placed at s along a beam line bending in the xz plane
+auto Placement(double s) -> Eigen::Transform<double, 3, Eigen::Isometry> {
+    return Eigen::Translation3d{std::sin(s / 20) * 20, 0, std::sin(s / 20) * s} *
+           Eigen::AngleAxisd{s / 20, Eigen::Vector3d::UnitY()};
+}
+
+auto Place(double s) -> Magnet {
+    return {Placement(s), muc::array3d{-1, -1, -1}, muc::array3d{1, 1, 1},
+            muc::array3d{-1, -1, -1}, muc::array3d{1, 1, 1}, std::array{21, 21, 21}, Dipole};
+}
+
+// the same magnet without bounding box, evaluated everywhere
+auto PlaceUnbounded(double s) -> PlacedField<Map> {
+    return {Placement(s), muc::array3d{-1, -1, -1}, muc::array3d{1, 1, 1}, std::array{21, 21, 21}, Dipole};
+}
+
+int main() {
+    auto ok{true};
+    static_assert(MagneticField<Magnet>);
+
+    // B(x) = R B_local(R^-1 (x - x0)), zero outside the box
+    const Eigen::Transform<double, 3, Eigen::Isometry> placement{Eigen::Translation3d{1, 2, 3} *
+                                                                 Eigen::AngleAxisd{0.3, Eigen::Vector3d{1, 2, 2}.normalized()}};
+    const Magnet magnet{placement, muc::array3d{-1, -1, -1}, muc::array3d{1, 1, 1},
+                        muc::array3d{-1, -1, -1}, muc::array3d{1, 1, 1}, std::array{21, 21, 21}, Dipole};
+    const Map local{{-1, -1, -1}, {1, 1, 1}, {21, 21, 21}, Dipole};
+    auto maxDiff{0.};
+    auto containOk{true};
+    std::mt19937_64 rng{1};
+    std::uniform_real_distribution<double> u{-1.5, 1.5};
+    for (int n{}; n < 10000; ++n) {
+        const Eigen::Vector3d xl{u(rng), u(rng), u(rng)};
+        const auto inside{xl.cwiseAbs().maxCoeff() <= 1};
+        const Eigen::Vector3d x{placement * xl};
+        const Eigen::Vector3d expected{inside ? Eigen::Vector3d{placement.linear() * local.B(xl)} : Eigen::Vector3d::Zero()};
+        maxDiff = std::max(maxDiff, (magnet.B(x) - expected).cwiseAbs().maxCoeff());
+        containOk = containOk and magnet.Contains(x) == inside;
+    }
+    std::cout << "PlacedField: max |B - R B_local| = " << maxDiff << ", Contains: " << containOk << '\n';
+    ok = ok and maxDiff < 1e-12 and containOk;
+
+    // a beam line of magnets, only those containing the point are evaluated
+    const FieldSuperposition beamLine{Place(0), Place(4), Place(8), Place(12), Place(16), Place(20), Place(24), Place(28)};
+    const std::array magnets{Place(0), Place(4), Place(8), Place(12), Place(16), Place(20), Place(24), Place(28)};
+    std::uniform_real_distribution<double> ux{-2, 30};
+    std::vector<muc::array3d> point;
+    for (int n{}; n < 100000; ++n) {
+        const auto s{ux(rng)};
+        point.push_back({std::sin(s / 20) * 20 + 0.3 * u(rng), 0.5 * u(rng), std::sin(s / 20) * s + 0.3 * u(rng)});
+    }
+    maxDiff = 0;
+    for (auto&& x : point) {
+        Eigen::Vector3d expected{Eigen::Vector3d::Zero()};
+        for (auto&& m : magnets) { expected += Eigen::Vector3d{m.B(Eigen::Vector3d{x[0], x[1], x[2]})}; }
+        const auto b{beamLine.B(x)};
+        for (int i{}; i < 3; ++i) { maxDiff = std::max(maxDiff, std::abs(b[i] - expected[i])); }
+    }
+    std::cout << "FieldSuperposition of bounded fields: max |B - sum B_i| = " << maxDiff << '\n';
+    ok = ok and maxDiff < 1e-12;
+
+    // bake to a grid, then reuse the cache file
+    const muc::array3d x0{-2, -2, -2};
+    const muc::array3d x1{22, 2, 26};
+    const std::array n{97, 17, 113};
+    const auto cache{std::filesystem::temp_directory_path() / "Mustard_PlacedField_test.mfm"};
+    std::filesystem::remove(cache);
+    muc::wall_time_stopwatch<> stopwatch;
+    const auto baked{BakeField(beamLine, x0, x1, n, cache)};
+    const auto bakeTime{stopwatch.ms_elapsed()};
+    stopwatch = {};
+    const auto cached{BakeField(beamLine, x0, x1, n, cache)};
+    const auto loadTime{stopwatch.ms_elapsed()};
+    maxDiff = 0;
+    auto cacheDiff{0.};
+    for (int i{}; i < n[0]; i += 7) {
+        for (int j{}; j < n[1]; j += 3) {
+            for (int k{}; k < n[2]; k += 5) {
+                const muc::array3d x{x0[0] + (x1[0] - x0[0]) * i / (n[0] - 1),
+                                     x0[1] + (x1[1] - x0[1]) * j / (n[1] - 1),
+                                     x0[2] + (x1[2] - x0[2]) * k / (n[2] - 1)};
+                const auto b{baked.B(x)};
+                const auto bc{cached.B(x)};
+                const auto expected{beamLine.B(x)};
+                for (int c{}; c < 3; ++c) {
+                    maxDiff = std::max(maxDiff, std::abs(b[c] - expected[c]));
+                    cacheDiff = std::max(cacheDiff, std::abs(bc[c] - b[c]));
+                }
+            }
+        }
+    }
+    std::cout << "BakeField: max node |B_baked - B| = " << maxDiff << ", cached vs baked = " << cacheDiff
+              << " (bake " << bakeTime << " ms, load " << loadTime << " ms)\n";
+    ok = ok and maxDiff < 1e-12 and cacheDiff == 0;
+
+    // a cache of another field is stale and gets replaced
+    const FieldSuperposition shorter{Place(0), Place(4), Place(8), Place(12), Place(16), Place(20), Place(28)};
+    const auto rebaked{BakeField(shorter, x0, x1, n, cache)};
+    const muc::array3d probe{std::sin(1.2) * 20, 0, std::sin(1.2) * 24}; // center of the removed magnet
+    const auto staleOk{rebaked.B(probe)[1] == 0 and baked.B(probe)[1] > 0.5};
+    std::cout << "BakeField detects stale cache: " << staleOk << '\n';
+    ok = ok and staleOk;
+    std::filesystem::remove(cache);
+
+    // cost per evaluation
+    double sum{};
+    stopwatch = {};
+    for (auto&& x : point) { sum += beamLine.B(x)[1]; }
+    const auto sumTime{stopwatch.ms_elapsed()};
+    const FieldSuperposition unculled{PlaceUnbounded(0), PlaceUnbounded(4), PlaceUnbounded(8), PlaceUnbounded(12),
+                                      PlaceUnbounded(16), PlaceUnbounded(20), PlaceUnbounded(24), PlaceUnbounded(28)};
+    stopwatch = {};
+    for (auto&& x : point) { sum += unculled.B(x)[1]; }
+    const auto bruteTime{stopwatch.ms_elapsed()};
+    stopwatch = {};
+    for (auto&& x : point) { sum += baked.B(x)[1]; }
+    const auto bakedTime{stopwatch.ms_elapsed()};
+    std::cout << "8 magnets: culled sum " << sumTime * 1e6 / point.size() << " ns/eval, unculled "
+              << bruteTime * 1e6 / point.size() << " ns/eval, baked " << bakedTime * 1e6 / point.size()
+              << " ns/eval (checksum " << sum << ")\n";
+
+    std::cout << (ok ? "Passed" : "Failed") << std::endl;
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
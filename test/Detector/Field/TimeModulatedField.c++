@@ -0,0 +1,102 @@
+#include "Mustard/Detector/Field/AsG4Field.h++"
+#include "Mustard/Detector/Field/FieldSuperposition.h++"
+#include "Mustard/Detector/Field/GridFieldMap3D.h++"
+#include "Mustard/Detector/Field/MagneticFieldMap.h++"
+#include "Mustard/Detector/Field/TabulatedTimeProfile.h++"
+#include "Mustard/Detector/Field/TimeModulatedField.h++"
+#include "Mustard/Detector/Field/UniformElectricField.h++"
+#include "Mustard/Detector/Field/UniformMagneticField.h++"
+
+#include "Eigen/Core"
+
+#include "muc/array"
+#include "muc/time"
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace Mustard::Detector::Field;
+
+using Map = MagneticFieldMap<GridFieldMap3D<Eigen::Vector3d>>;
+
+auto Dipole(double, double, double z) -> Eigen::Vector3d { return {0, 1 / (1 + z * z), 0}; }
+auto Quadrupole(double x, double y, double) -> Eigen::Vector3d { return {y, x, 0}; }
+
+int main() {
+    auto ok{true};
+
+    // kinds are preserved, so AsG4Field picks the same Geant4 field type
+    const auto Pulse{[](double t) { return std::exp(-t * t); }};
+    using PulsedMap = TimeModulatedField<Map, decltype(Pulse)>;
+    static_assert(MagneticField<PulsedMap> and TimeDependentField<PulsedMap>);
+    static_assert(ElectricField<TimeModulatedField<UniformElectricField, TabulatedTimeProfile>>);
+    static_assert(MagneticField<FieldSuperposition<PulsedMap, UniformMagneticField>>);
+    static_assert(not MagneticField<FieldSuperposition<PulsedMap, UniformElectricField>> and
+                  not ElectricField<FieldSuperposition<PulsedMap, UniformElectricField>>);
+
+    // f(t) * field
+    const PulsedMap pulsed{Pulse, muc::array3d{-1, -1, -1}, muc::array3d{1, 1, 1}, std::array{21, 21, 21}, Dipole};
+    const Map dipole{{-1, -1, -1}, {1, 1, 1}, {21, 21, 21}, Dipole};
+    const muc::array3d x{0.1, 0.2, 0.3};
+    auto maxDiff{0.};
+    for (auto t : {-2., -0.5, 0., 0.7}) {
+        const auto b{pulsed.B(x, t)};
+        const auto b0{dipole.B(x)};
+        for (int i{}; i < 3; ++i) { maxDiff = std::max(maxDiff, std::abs(b[i] - Pulse(t) * b0[i])); }
+    }
+    std::cout << "TimeModulatedField: max |B(x, t) - f(t) B(x)| = " << maxDiff << '\n';
+    ok = ok and maxDiff < 1e-15;
+
+    // tabulated profile: linear ramp up, flat top, clamped outside
+    const TabulatedTimeProfile ramp{{0, 10, 20}, {0, 1, 1}};
+    const auto rampOk{ramp(-1) == 0 and ramp(5) == 0.5 and ramp(15) == 1 and ramp(30) == 1};
+    std::cout << "TabulatedTimeProfile: " << rampOk << '\n';
+    ok = ok and rampOk;
+
+    // weighted superposition of static maps
+    const FieldSuperposition superposition{TimeModulatedField{ramp, dipole},
+                                           TimeModulatedField<Map, decltype(Pulse)>{Pulse, muc::array3d{-1, -1, -1}, muc::array3d{1, 1, 1}, std::array{21, 21, 21}, Quadrupole}};
+    const Map quadrupole{{-1, -1, -1}, {1, 1, 1}, {21, 21, 21}, Quadrupole};
+    maxDiff = 0;
+    for (auto t : {-1., 0.5, 5., 12.}) {
+        const auto b{superposition.B(x, t)};
+        const auto bd{dipole.B(x)};
+        const auto bq{quadrupole.B(x)};
+        for (int i{}; i < 3; ++i) { maxDiff = std::max(maxDiff, std::abs(b[i] - ramp(t) * bd[i] - Pulse(t) * bq[i])); }
+    }
+    std::cout << "FieldSuperposition: max |B(x, t) - sum w_i(t) B_i(x)| = " << maxDiff << '\n';
+    ok = ok and maxDiff < 1e-15;
+
+    // Geant4 passes the time of the track as x[3]
+    const AsG4Field<PulsedMap> g4Field{Pulse, muc::array3d{-1, -1, -1}, muc::array3d{1, 1, 1}, std::array{21, 21, 21}, Dipole};
+    const G4double point[4]{x[0], x[1], x[2], 0.7};
+    G4double b[3];
+    g4Field.GetFieldValue(point, b);
+    const auto b07{pulsed.B(x, 0.7)};
+    const auto g4Ok{b[0] == b07[0] and b[1] == b07[1] and b[2] == b07[2]};
+    std::cout << "AsG4Field passes time: " << g4Ok << '\n';
+    ok = ok and g4Ok;
+
+    // cost: one map lookup per component map
+    std::mt19937_64 random;
+    std::uniform_real_distribution<double> uniform{-1, 1};
+    std::vector<muc::array3d> point3(1'000'000);
+    for (auto&& xi : point3) { xi = {uniform(random), uniform(random), uniform(random)}; }
+    auto sum{0.};
+    muc::wall_time_stopwatch<> stopwatch;
+    for (auto&& xi : point3) { sum += dipole.B(xi)[1]; }
+    const auto staticTime{stopwatch.ms_elapsed()};
+    stopwatch = {};
+    for (auto&& xi : point3) { sum += pulsed.B(xi, xi[0])[1]; }
+    const auto modulatedTime{stopwatch.ms_elapsed()};
+    stopwatch = {};
+    for (auto&& xi : point3) { sum += superposition.B(xi, xi[0])[1]; }
+    const auto superpositionTime{stopwatch.ms_elapsed()};
+    std::cout << "static map: " << staticTime * 1e6 / point3.size() << " ns/eval, modulated: " << modulatedTime * 1e6 / point3.size()
+              << " ns/eval, superposition of 2: " << superpositionTime * 1e6 / point3.size() << " ns/eval (checksum " << sum << ")\n";
+
+    std::cout << (ok ? "Passed" : "Failed") << std::endl;
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,59 @@
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Env/Print.h++"
+#include "Mustard/Extension/MPIX/Reduction/AsyncReduction.h++"
+#include "Mustard/Extension/MPIX/Reduction/HistogramMerge.h++"
+#include "Mustard/Extension/MPIX/Reduction/Reducer.h++"
+#include "Mustard/Extension/MPIX/Reduction/StatisticMerge.h++"
+#include "Mustard/Math/Statistic.h++"
+
+#include "TH1D.h"
+
+#include <array>
+#include <thread>
+
+using namespace Mustard;
+using namespace std::chrono_literals;
+
+auto main(int argc, char* argv[]) -> int {
+    Mustard::Env::MPIEnv env{argc, argv, {}};
+
+    for (auto topology : {MPIX::ReductionTopology::Flat, MPIX::ReductionTopology::NodeHierarchical}) {
+        long long nEvent{env.CommWorldRank() + 1};
+        std::array<double, 3> counter{1., 1. * env.CommWorldRank(), -1. * env.CommWorldRank()};
+        double maxEnergy{10. * env.CommWorldRank()};
+        Math::Statistic<1> statistic;
+        TH1D histogram{"h", "h", 10, 0, 10};
+        histogram.SetDirectory(nullptr);
+        for (int i{}; i <= env.CommWorldRank(); ++i) {
+            statistic.Fill(i);
+            histogram.Fill(i);
+        }
+        // only odd ranks fill with weights (and have Sumw2)
+        TH1D weighted{"w", "w", 10, 0, 10};
+        weighted.SetDirectory(nullptr);
+        weighted.Fill(env.CommWorldRank(), env.CommWorldRank() % 2 ? 2. : 1.);
+
+        auto nEventReduction{MPIX::IReduce<MPIX::Sum>(nEvent, topology)};
+        auto counterReduction{MPIX::IAllReduce<MPIX::Sum>(counter, topology)};
+        auto maxEnergyReduction{MPIX::IAllReduce<MPIX::Max>(maxEnergy, topology)};
+        auto statisticReduction{MPIX::IReduce<MPIX::StatisticMerge>(statistic, topology)};
+        auto histogramReduction{MPIX::IReduce<MPIX::HistogramMerge>(histogram, topology)};
+        auto weightedReduction{MPIX::IReduce<MPIX::HistogramMerge>(weighted, topology)};
+        // overlap with computation
+        while (not histogramReduction.Test()) {
+            std::this_thread::sleep_for(1ms);
+        }
+        nEventReduction.Wait();
+        counterReduction.Wait();
+        maxEnergyReduction.Wait();
+        statisticReduction.Wait();
+        weightedReduction.Wait();
+
+        Env::PrintLn("{}: {},{},{},{},{},{},{},{},{},{},{}", env.CommWorldRank(),
+                     nEvent, counter[0], counter[1], counter[2], maxEnergy,
+                     statistic.WeightSum(), statistic.Mean(), histogram.GetEntries(), histogram.GetMean(),
+                     weighted.GetSumOfWeights(), weighted.GetSumw2()->GetSum());
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -47,5 +47,14 @@ auto main(int argc, char* argv[]) -> int {
                          std::this_thread::sleep_for(500ms);
                      });
 
+    for (auto policy : {MPIX::ChunkSizePolicy::Guided, MPIX::ChunkSizePolicy::Factoring, MPIX::ChunkSizePolicy::CostModel}) {
+        executor.ChunkPolicy(policy);
+        executor.Execute(n,
+                         [&](auto i) {
+                             std::this_thread::sleep_for(500ms);
+                             Env::PrintLn("{},{}", i, env.CommWorldRank());
+                         });
+    }
+
     return EXIT_SUCCESS;
 }
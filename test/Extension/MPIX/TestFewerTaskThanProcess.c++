@@ -0,0 +1,79 @@
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Env/Print.h++"
+#include "Mustard/Extension/MPIX/Execution/DynamicScheduler.h++"
+#include "Mustard/Extension/MPIX/Execution/Executor.h++"
+#include "Mustard/Extension/MPIX/Execution/StaticScheduler.h++"
+#include "Mustard/Extension/MPIX/Execution/WorkStealingScheduler.h++"
+
+#include "mpi.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+#include <numeric>
+#include <string_view>
+#include <vector>
+
+using namespace Mustard;
+
+// gather executed tasks of all processes and compare them with expected
+auto Check(std::string_view name, std::vector<long> executed, std::vector<long> expected) -> bool {
+    const auto& mpiEnv{Env::MPIEnv::Instance()};
+    const auto n{static_cast<int>(executed.size())};
+    std::vector<int> count(mpiEnv.CommWorldSize());
+    MPI_Allgather(&n, 1, MPI_INT, count.data(), 1, MPI_INT, MPI_COMM_WORLD);
+    std::vector<int> displacement(count.size());
+    std::exclusive_scan(count.cbegin(), count.cend(), displacement.begin(), 0);
+    std::vector<long> all(displacement.back() + count.back());
+    MPI_Allgatherv(executed.data(), n, MPI_LONG, all.data(), count.data(), displacement.data(), MPI_LONG, MPI_COMM_WORLD);
+    std::ranges::sort(all);
+    const auto ok{all == expected};
+    if (not ok) { Env::PrintLn("{}: executed tasks mismatch", name); }
+    return ok;
+}
+
+template<template<typename> typename S>
+auto Test(std::string_view name, int nThread) -> bool {
+    const auto size{static_cast<long>(Env::MPIEnv::Instance().CommWorldSize())};
+    MPIX::Executor<long> executor{MPIX::ScheduleBy<S>{}};
+    executor.PrintProgress(false);
+    executor.NThread(nThread);
+    auto ok{true};
+    std::vector<long> executed;
+    std::mutex mutex;
+    const auto Record{[&](long i) {
+        const std::scoped_lock lock{mutex};
+        executed.push_back(i);
+    }};
+    // fewer tasks than processes, including none
+    for (auto n : {0l, 1l, size - 1, size + 1}) {
+        executed.clear();
+        executor.Execute(n, Record);
+        std::vector<long> expected(std::max(0l, n));
+        std::iota(expected.begin(), expected.end(), 0);
+        ok = Check(name, executed, expected) and ok;
+    }
+    // sparse task set smaller than number of processes
+    const std::vector<MPIX::Executor<long>::Interval> taskSet{{3, 4}, {10, 10 + std::max(1l, size / 2 - 1)}};
+    executed.clear();
+    executor.Execute(taskSet, Record);
+    std::vector<long> expected;
+    for (auto [first, last] : taskSet) {
+        for (auto i{first}; i < last; ++i) { expected.push_back(i); }
+    }
+    ok = Check(name, executed, expected) and ok;
+    return ok;
+}
+
+auto main(int argc, char* argv[]) -> int {
+    Mustard::Env::MPIEnv env{argc, argv, {}};
+
+    auto ok{true};
+    for (auto nThread : {1, 2}) {
+        ok = Test<MPIX::StaticScheduler>("StaticScheduler", nThread) and ok;
+        ok = Test<MPIX::DynamicScheduler>("DynamicScheduler", nThread) and ok;
+        ok = Test<MPIX::WorkStealingScheduler>("WorkStealingScheduler", nThread) and ok;
+    }
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
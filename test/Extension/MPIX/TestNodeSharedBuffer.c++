@@ -0,0 +1,31 @@
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Env/Print.h++"
+#include "Mustard/Extension/MPIX/NodeSharedBuffer.h++"
+
+#include <numeric>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace Mustard;
+
+auto main(int argc, char* argv[]) -> int {
+    Mustard::Env::MPIEnv env{argc, argv, {}};
+
+    const auto n{std::stoull(argv[1])};
+
+    MPIX::NodeSharedBuffer<double> constructed{n,
+                                               [](std::span<double> data) {
+                                                   std::iota(data.begin(), data.end(), 0.);
+                                               }};
+    MPIX::NodeSharedBuffer<double> loaded{[&] {
+        return std::vector<double>(n, 1.);
+    }};
+
+    Env::PrintLn("{},{},{},{},{}", env.CommWorldRank(), env.LocalNodeID(),
+                 std::accumulate(constructed.begin(), constructed.end(), 0.),
+                 std::accumulate(loaded.begin(), loaded.end(), 0.),
+                 static_cast<const void*>(constructed.Data()));
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,85 @@
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Env/Print.h++"
+#include "Mustard/Extension/MPIX/Execution/DynamicScheduler.h++"
+#include "Mustard/Extension/MPIX/Execution/Executor.h++"
+#include "Mustard/Extension/MPIX/Execution/StaticScheduler.h++"
+#include "Mustard/Extension/MPIX/Execution/WorkStealingScheduler.h++"
+
+#include "mpi.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <string_view>
+#include <vector>
+
+using namespace Mustard;
+
+// write a checkpoint of task [0, n) in which all tasks except remained have been executed
+auto WriteCheckpoint(const std::filesystem::path& path, long n, const std::vector<long>& remained) -> void {
+    if (Env::MPIEnv::Instance().OnCommWorldMaster()) {
+        std::ofstream os{path};
+        os << "task 0 " << n << '\n';
+        long begin{};
+        for (auto i : remained) {
+            if (begin < i) { os << begin << " 1 " << i - begin << '\n'; }
+            begin = i + 1;
+        }
+        if (begin < n) { os << begin << " 1 " << n - begin << '\n'; }
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+}
+
+// gather executed tasks of all processes and compare them with expected
+auto Check(std::string_view name, std::vector<long> executed, const std::vector<long>& expected) -> bool {
+    const auto& mpiEnv{Env::MPIEnv::Instance()};
+    const auto n{static_cast<int>(executed.size())};
+    std::vector<int> count(mpiEnv.CommWorldSize());
+    MPI_Allgather(&n, 1, MPI_INT, count.data(), 1, MPI_INT, MPI_COMM_WORLD);
+    std::vector<int> displacement(count.size());
+    std::exclusive_scan(count.cbegin(), count.cend(), displacement.begin(), 0);
+    std::vector<long> all(displacement.back() + count.back());
+    MPI_Allgatherv(executed.data(), n, MPI_LONG, all.data(), count.data(), displacement.data(), MPI_LONG, MPI_COMM_WORLD);
+    std::ranges::sort(all);
+    const auto ok{all == expected};
+    if (not ok) { Env::PrintLn("{}: executed tasks mismatch after resume", name); }
+    return ok;
+}
+
+template<template<typename> typename S>
+auto Test(std::string_view name, const std::filesystem::path& path) -> bool {
+    const auto size{static_cast<long>(Env::MPIEnv::Instance().CommWorldSize())};
+    const auto n{100 * size};
+    MPIX::Executor<long> executor{MPIX::ScheduleBy<S>{}};
+    executor.PrintProgress(false);
+    auto ok{true};
+    std::vector<long> executed;
+    // fewer remaining tasks than processes: a contiguous tail, and scattered tasks
+    std::vector<long> tail(std::max(1l, size - 1));
+    std::iota(tail.begin(), tail.end(), n - ssize(tail));
+    std::vector<long> scattered;
+    for (long i{}; i < std::max(1l, size / 2); ++i) { scattered.push_back(7 + 13 * i); }
+    for (auto&& remained : {tail, scattered}) {
+        WriteCheckpoint(path, n, remained);
+        executed.clear();
+        executor.Resume(path);
+        executor.Execute(n, [&](auto i) { executed.push_back(i); });
+        ok = Check(name, executed, remained) and ok;
+    }
+    return ok;
+}
+
+auto main(int argc, char* argv[]) -> int {
+    Mustard::Env::MPIEnv env{argc, argv, {}};
+
+    const auto path{std::filesystem::temp_directory_path() / "TestResumeFewerTaskThanProcess.txt"};
+    auto ok{true};
+    ok = Test<MPIX::StaticScheduler>("StaticScheduler", path) and ok;
+    ok = Test<MPIX::DynamicScheduler>("DynamicScheduler", path) and ok;
+    ok = Test<MPIX::WorkStealingScheduler>("WorkStealingScheduler", path) and ok;
+    if (env.OnCommWorldMaster()) { std::filesystem::remove(path); }
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,57 @@
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Env/Print.h++"
+#include "Mustard/Extension/MPIX/Execution/Executor.h++"
+#include "Mustard/Extension/MPIX/Execution/StaticScheduler.h++"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Mustard;
+using namespace std::chrono_literals;
+
+auto main(int argc, char* argv[]) -> int {
+    Mustard::Env::MPIEnv env{argc, argv, {}};
+
+    MPIX::Executor<unsigned long long> executor;
+
+    const auto n{std::stoull(argv[1])};
+    const auto nThread{std::stoi(argv[2])};
+
+    executor.NThread(nThread);
+    // per-thread state
+    std::vector<unsigned long long> sum(nThread);
+    executor.Execute(n,
+                     [&](auto i) {
+                         std::this_thread::sleep_for(10ms);
+                         sum[executor.ThreadIndex()] += i;
+                     });
+    executor.PrintExecutionSummary();
+    for (int t{}; t < nThread; ++t) {
+        Env::PrintLn("{},{},{}", env.CommWorldRank(), t, sum[t]);
+    }
+
+    // cost model observes task time while dispatching
+    executor.ChunkPolicy(MPIX::ChunkSizePolicy::CostModel);
+    std::ranges::fill(sum, 0);
+    executor.Execute(n,
+                     [&](auto i) {
+                         std::this_thread::sleep_for(1ms);
+                         sum[executor.ThreadIndex()] += i;
+                     });
+    executor.PrintExecutionSummary();
+    for (int t{}; t < nThread; ++t) {
+        Env::PrintLn("{},{},{}", env.CommWorldRank(), t, sum[t]);
+    }
+
+    executor.SwitchScheduler<MPIX::StaticScheduler>();
+    executor.ProfileTaskTime(true);
+    executor.Execute(n,
+                     [&](auto i) {
+                         std::this_thread::sleep_for(1ms * (i % 10));
+                     });
+    executor.PrintExecutionSummary();
+
+    return EXIT_SUCCESS;
+}